@@ -1 +0,0 @@
-extern unsigned char arial_data[1036584];
\ No newline at end of file
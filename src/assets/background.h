@@ -1,4 +0,0 @@
-constexpr int background_width = 1920;
-constexpr int background_height = 1080;
-constexpr int background_channels = 3;
-extern unsigned char background_data[6220800];
\ No newline at end of file
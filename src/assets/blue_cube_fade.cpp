@@ -1 +0,0 @@
-unsigned char blue_cube_fade_data[4] = {0x00, 0xB7, 0xEF, 0xB3, };
\ No newline at end of file
@@ -1,4 +0,0 @@
-constexpr int blue_cube_fade_width = 1;
-constexpr int blue_cube_fade_height = 1;
-constexpr int blue_cube_fade_channels = 4;
-extern unsigned char blue_cube_fade_data[4];
\ No newline at end of file
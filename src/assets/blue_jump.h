@@ -1,4 +0,0 @@
-constexpr int blue_jump_width = 512;
-constexpr int blue_jump_height = 512;
-constexpr int blue_jump_channels = 4;
-extern unsigned char blue_jump_data[1048576];
\ No newline at end of file
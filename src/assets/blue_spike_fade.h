@@ -1,4 +0,0 @@
-constexpr int blue_spike_fade_width = 512;
-constexpr int blue_spike_fade_height = 256;
-constexpr int blue_spike_fade_channels = 4;
-extern unsigned char blue_spike_fade_data[524288];
\ No newline at end of file
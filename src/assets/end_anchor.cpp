@@ -1 +0,0 @@
-unsigned char end_anchor_data[12288] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0xD9, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
\ No newline at end of file
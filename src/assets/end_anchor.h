@@ -1,4 +0,0 @@
-constexpr int end_anchor_width = 64;
-constexpr int end_anchor_height = 64;
-constexpr int end_anchor_channels = 3;
-extern unsigned char end_anchor_data[12288];
\ No newline at end of file
@@ -1,4 +0,0 @@
-constexpr int neutral_cube_width = 512;
-constexpr int neutral_cube_height = 512;
-constexpr int neutral_cube_channels = 4;
-extern unsigned char neutral_cube_data[1048576];
\ No newline at end of file
@@ -1,4 +0,0 @@
-constexpr int neutral_jump_width = 512;
-constexpr int neutral_jump_height = 512;
-constexpr int neutral_jump_channels = 4;
-extern unsigned char neutral_jump_data[1048576];
\ No newline at end of file
@@ -1,4 +0,0 @@
-constexpr int neutral_spike_width = 512;
-constexpr int neutral_spike_height = 256;
-constexpr int neutral_spike_channels = 4;
-extern unsigned char neutral_spike_data[524288];
\ No newline at end of file
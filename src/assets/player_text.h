@@ -1,4 +0,0 @@
-constexpr int player_text_width = 320;
-constexpr int player_text_height = 320;
-constexpr int player_text_channels = 4;
-extern unsigned char player_text_data[409600];
\ No newline at end of file
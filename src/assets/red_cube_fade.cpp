@@ -1 +0,0 @@
-unsigned char red_cube_fade_data[4] = {0xED, 0x1C, 0x24, 0xB3, };
\ No newline at end of file
@@ -1,4 +0,0 @@
-constexpr int red_jump_width = 512;
-constexpr int red_jump_height = 512;
-constexpr int red_jump_channels = 4;
-extern unsigned char red_jump_data[1048576];
\ No newline at end of file
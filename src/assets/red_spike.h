@@ -1,4 +0,0 @@
-constexpr int red_spike_width = 512;
-constexpr int red_spike_height = 256;
-constexpr int red_spike_channels = 4;
-extern unsigned char red_spike_data[524288];
\ No newline at end of file
@@ -1 +0,0 @@
-unsigned char spawn_anchor_data[16384] = {0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x4C, 0xAF, 0x50, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, };
\ No newline at end of file
@@ -1,4 +0,0 @@
-constexpr int spawn_anchor_width = 64;
-constexpr int spawn_anchor_height = 64;
-constexpr int spawn_anchor_channels = 4;
-extern unsigned char spawn_anchor_data[16384];
\ No newline at end of file
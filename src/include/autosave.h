@@ -0,0 +1,53 @@
+#ifndef AUTOSAVE_H
+#define AUTOSAVE_H
+
+#include "level.h"
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// writes snapshots of a level on another thread so saving never blocks the caller
+// only one save runs at a time, a save requested while one is still being written is skipped
+class autosave
+{
+public:
+	// done is called on the saving thread after each save, such as to wake up an event loop waiting for input
+	explicit autosave(std::function<void()> done = {}) : m_done(std::move(done)) {}
+	// waits for a save that's still being written
+	~autosave() { wait(); }
+
+	autosave(const autosave &) = delete;
+	autosave &operator=(const autosave &) = delete;
+
+	// starts writing snapshot to filename with write_file, returns false and counts a skip if the last save hasn't finished
+	bool save(std::shared_ptr<const level> snapshot, std::filesystem::path filename);
+	void wait();
+
+	struct status
+	{
+		std::size_t saved = 0;
+		std::size_t skipped = 0;
+		bool saving = false;
+		// of the last save that finished, encoding and writing
+		std::chrono::steady_clock::duration latency{};
+		std::chrono::steady_clock::time_point finished;
+		// empty if the last save succeeded
+		std::string error;
+	};
+	status get_status() const;
+
+private:
+	std::function<void()> m_done;
+
+	mutable std::mutex m_mutex;
+	status m_status;
+
+	std::future<void> m_pending;
+};
+
+#endif
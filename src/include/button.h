@@ -34,11 +34,11 @@ public:
 
 		// set uniforms
 		glUseProgram(program.id);
-		glUniformMatrix4fv(glGetUniformLocation(program.id, "ortho"), 1, GL_FALSE, &gl.get_ortho()[0][0]);
-		glUniform4fv(glGetUniformLocation(program.id, "color"), 1, &background_color[0]);
+		program.set(uniform::ortho, gl.get_ortho());
+		program.set(uniform::color, background_color);
 
 		auto m = glm::scale(glm::translate(glm::mat4(1.f), {m_box.min + m_box.dims / 2.f, 0}), {m_box.dims, 0});
-		glUniformMatrix4fv(glGetUniformLocation(program.id, "model"), 1, GL_FALSE, &m[0][0]);
+		program.set(uniform::model, m);
 
 		glBindVertexArray(gl.get_shapes().square_vao().id);
 		glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
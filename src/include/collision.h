@@ -4,6 +4,7 @@
 #include <glm/mat4x4.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <vector>
+#include <cmath>
 
 inline glm::vec2 rotate(glm::vec2 v, float angle)
 {
@@ -36,7 +37,7 @@ struct collision
 class polygon
 {
 public:
-	polygon() : m_center{0, 0} {}
+	polygon() : m_center{0, 0}, m_unit_square{false} {}
 
 	template <typename T>
 	inline polygon(std::initializer_list<glm::vec<2, T>> pts) : polygon()
@@ -58,6 +59,7 @@ public:
 
 		m_pts.clear();
 		m_center = {0, 0};
+		m_unit_square = false;
 
 		if (first == last)
 			return;
@@ -74,6 +76,10 @@ public:
 		}
 
 		m_center /= m_pts.size();
+
+		m_unit_square = m_pts.size() == 4 &&
+						m_pts[0] == glm::vec2{-.5f, -.5f} && m_pts[1] == glm::vec2{.5f, -.5f} &&
+						m_pts[2] == glm::vec2{.5f, .5f} && m_pts[3] == glm::vec2{-.5f, .5f};
 	}
 
 	template <typename T>
@@ -85,12 +91,16 @@ public:
 
 	std::size_t size() const { return m_pts.size(); }
 
+	// true if the points are the unit square centered at the origin, counter clockwise from the bottom left
+	bool is_unit_square() const { return m_unit_square; }
+
 	auto begin() const { return m_pts.begin(); }
 	auto end() const { return m_pts.end(); }
 
 private:
 	std::vector<glm::vec2> m_pts;
 	glm::vec2 m_center;
+	bool m_unit_square;
 };
 
 struct polygon_view
@@ -126,6 +136,18 @@ struct polygon_view
 		return transform(poly->center());
 	}
 
+	// angle as a number of counter clockwise quarter turns in [0, 4), or -1 if it isn't a multiple of pi / 2
+	int quarter_turns() const
+	{
+		float turns = angle / (glm::pi<float>() / 2);
+		float rounded = std::round(turns);
+		if (std::abs(turns - rounded) > 1e-4f)
+			return -1;
+
+		int res = static_cast<int>(rounded) % 4;
+		return res < 0 ? res + 4 : res;
+	}
+
 	glm::vec2 transform(glm::vec2 pt) const
 	{
 		// as if 
@@ -145,15 +167,60 @@ struct polygon_view
 	}
 };
 
+// world space points, edge normals and bounds of a polygon_view, computed once for polygons that never move
+class baked_polygon
+{
+public:
+	baked_polygon() : m_center{}, m_min{}, m_max{}, m_box{false} {}
+	explicit baked_polygon(const polygon_view &view);
+
+	std::size_t size() const { return m_pts.size(); }
+
+	glm::vec2 point(std::size_t i) const { return m_pts[i]; }
+	glm::vec2 normal(std::size_t i) const { return m_normals[i]; }
+	glm::vec2 center() const { return m_center; }
+
+	const glm::vec2 *points() const { return m_pts.data(); }
+	const glm::vec2 *normals() const { return m_normals.data(); }
+
+	// axis aligned bounding box
+	glm::vec2 min() const { return m_min; }
+	glm::vec2 max() const { return m_max; }
+
+	// true if every edge is axis aligned, so the polygon is exactly its bounding box
+	bool is_box() const { return m_box; }
+
+private:
+	std::vector<glm::vec2> m_pts;
+	std::vector<glm::vec2> m_normals;
+	glm::vec2 m_center;
+	glm::vec2 m_min;
+	glm::vec2 m_max;
+	bool m_box;
+};
+
 inline glm::mat4 model(glm::vec2 offset, glm::vec2 scale, float angle)
 {
 	auto res = glm::scale(glm::rotate(glm::translate(glm::mat4(1.f), {offset, 0}), angle, {0, 0, 1}), {scale, 0});
 	return res;
 }
 
+// unit square centered at the origin
+const polygon &square();
+// constexpr float triangle_poly_width = .8f;
+// unit triangle centered at the origin, pointing up
+const polygon &triangle();
+
 // returns collision with mtv to get a out of b or false if no collision
+// uses an exact axis aligned test when a is a unit square and both are rotated by a multiple of pi / 2
 collision collides(const polygon_view &a, const polygon_view &b);
 
+// same as above, using the cached world space shape of b
+collision collides(const polygon_view &a, const baked_polygon &b);
+
+// general separating axis test for any convex polygons, same result as collides
+collision collides_sat(const polygon_view &a, const polygon_view &b);
+
 #ifdef MAPJUMP_DEBUG
 
 #include <ostream>
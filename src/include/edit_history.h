@@ -0,0 +1,83 @@
+#ifndef EDIT_HISTORY_H
+#define EDIT_HISTORY_H
+
+#include "level_grid.h"
+
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// undo and redo for a level_grid, a step only stores the state of each cell it changed before and after it
+// touch every cell before changing it, the changes made until commit are undone together (a click or a whole drag)
+// the anchors are part of a step too, painting over one removes it and undo has to put it back
+class edit_history
+{
+public:
+	struct anchors
+	{
+		glm::ivec2 start;
+		glm::ivec2 end;
+		bool has_spawn;
+		bool has_end;
+
+		bool operator==(const anchors &) const = default;
+	};
+
+	// saves the state of cell the first time it's touched in the current step, cells outside the map are ignored
+	void touch(const level_grid &grid, glm::ivec2 cell);
+	// saves the anchors the first time they're touched in the current step, call before changing them
+	void touch_anchors(const anchors &current);
+	// ends the current step, cells that ended up the same are dropped and a step with no changes isn't kept
+	// a new step discards anything that was undone
+	void commit(const level_grid &grid, const anchors &current);
+
+	// both commit the current step first, return false if there was nothing to undo or redo
+	// current is set to the anchors from before or after the step if it changed them
+	bool undo(level_grid &grid, anchors &current);
+	bool redo(level_grid &grid, anchors &current);
+
+	// neither counts the step that hasn't been committed yet
+	bool can_undo() const { return m_done > 0; }
+	bool can_redo() const { return m_done < m_step_end.size(); }
+
+private:
+	static constexpr int cell_count = level_grid::width * level_grid::height;
+	static_assert(cell_count <= 1 << (32 - level_grid::cell_state_bits), "cell index doesn't fit next to a cell state");
+
+	// the cell index is stored above the before state
+	struct delta
+	{
+		std::uint32_t cell_before;
+		level_grid::cell_state after;
+
+		int cell() const { return static_cast<int>(cell_before >> level_grid::cell_state_bits); }
+		level_grid::cell_state before() const { return cell_before & ((1u << level_grid::cell_state_bits) - 1); }
+	};
+
+	static glm::ivec2 location(int cell) { return {cell % level_grid::width, cell / level_grid::width}; }
+
+	// only the few steps that moved or removed an anchor have one, sorted by step
+	struct anchor_step
+	{
+		std::size_t step;
+		anchors before;
+		anchors after;
+	};
+	const anchor_step *find_anchor_step(std::size_t step) const;
+
+	// steps are m_deltas[m_step_end[i - 1]] to m_deltas[m_step_end[i]], the first m_done have been applied
+	std::vector<delta> m_deltas;
+	std::vector<std::uint32_t> m_step_end;
+	std::size_t m_done = 0;
+
+	// cells touched in the current step, after is filled in by commit
+	std::vector<delta> m_pending;
+	std::bitset<cell_count> m_touched;
+
+	std::vector<anchor_step> m_anchor_steps;
+	// the anchors before the current step if it touched them
+	std::optional<anchors> m_pending_anchors;
+};
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+
+// keeps frames at a target rate without spinning a core for the whole wait
+// also records the time between frames so pacing quality can be checked
+class frame_pacer
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	enum class mode
+	{
+		sleep, // sleep through most of the wait, then wait out the last bit precisely
+		vsync, // buffer swaps block until the display refreshes, no other waiting
+	};
+
+	// the current context's swap interval is set from the mode
+	frame_pacer(mode pacing_mode, int target_fps) :
+		m_mode{pacing_mode},
+		m_frame_duration{std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / target_fps))},
+		m_max_spin_margin{std::max<clock::duration>(m_frame_duration / 2, min_spin_margin)},
+		m_spin_margin{std::min<clock::duration>(std::chrono::milliseconds(2), m_max_spin_margin)},
+		m_deadline{clock::now()},
+		m_last_frame{},
+		m_intervals{},
+		m_interval_count{}
+	{
+		glfwSwapInterval(m_mode == mode::vsync ? 1 : 0);
+	}
+
+	mode get_mode() const { return m_mode; }
+	// also sets the current context's swap interval
+	void set_mode(mode pacing_mode)
+	{
+		m_mode = pacing_mode;
+		m_deadline = clock::now();
+		glfwSwapInterval(m_mode == mode::vsync ? 1 : 0);
+	}
+
+	// call once at the start of every frame
+	void begin_frame()
+	{
+		auto now = clock::now();
+		if (m_last_frame != clock::time_point{})
+			m_intervals[m_interval_count++ % sample_count] = std::chrono::duration<double>(now - m_last_frame).count();
+		m_last_frame = now;
+	}
+
+	// waits until the next frame is due, call after swapping buffers
+	void end_frame()
+	{
+		if (m_mode == mode::vsync)
+			return;
+
+		m_deadline += m_frame_duration;
+
+		auto now = clock::now();
+		// fell behind by more than a frame, don't try to catch up
+		if (now > m_deadline + m_frame_duration)
+			m_deadline = now;
+
+		// decays every frame, so a margin raised by one bad sleep comes back down even if the frames that follow don't sleep
+		m_spin_margin = std::max<clock::duration>(m_spin_margin - m_spin_margin / 64, min_spin_margin);
+
+		if (m_deadline - now > m_spin_margin)
+		{
+			auto requested = m_deadline - now - m_spin_margin;
+			std::this_thread::sleep_for(requested);
+
+			// sleep can overshoot by the scheduler's granularity, so keep the margin above the overshoots seen
+			// capped at half a frame so there's always time left to sleep
+			auto overshoot = clock::now() - now - requested;
+			m_spin_margin = std::clamp<clock::duration>(overshoot + overshoot / 2, m_spin_margin, m_max_spin_margin);
+		}
+
+		while (clock::now() < m_deadline)
+			std::this_thread::yield();
+	}
+
+	// mean time between frames over the last sample_count frames, in seconds
+	double mean_frame_time() const
+	{
+		std::size_t count = std::min(m_interval_count, sample_count);
+		if (!count)
+			return 0;
+
+		double sum = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			sum += m_intervals[i];
+		return sum / count;
+	}
+
+	// standard deviation of the time between frames over the last sample_count frames, in seconds
+	double jitter() const
+	{
+		std::size_t count = std::min(m_interval_count, sample_count);
+		if (count < 2)
+			return 0;
+
+		double mean = mean_frame_time();
+		double sum = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			sum += (m_intervals[i] - mean) * (m_intervals[i] - mean);
+		return std::sqrt(sum / (count - 1));
+	}
+
+private:
+	static constexpr std::size_t sample_count = 240;
+	static constexpr clock::duration min_spin_margin = std::chrono::microseconds(500);
+
+	mode m_mode;
+	clock::duration m_frame_duration;
+	clock::duration m_max_spin_margin;
+	// time before the deadline to stop sleeping and start yielding
+	clock::duration m_spin_margin;
+	clock::time_point m_deadline;
+	clock::time_point m_last_frame;
+
+	std::array<double, sample_count> m_intervals;
+	std::size_t m_interval_count;
+};
+
+#endif
@@ -1,17 +1,16 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include "game_assets.h"
 #include "collision.h"
 #include "level.h"
+#include "level_handle.h"
 
-#include "gl_instance.h"
-
-#include <chrono>
 #include <filesystem>
 
 #include <ranges>
 
+class level_cache;
+
 class game
 {
 public:
@@ -20,12 +19,20 @@ public:
 	static constexpr int player_size = 40;
 	static constexpr int map_width = 16;
 	static constexpr int map_height = 9;
+	// update is called once per tick, the simulation always steps at this rate
+	static constexpr int tick_rate = 60;
+	// how many ticks a jump request stays valid, .3 s
+	static constexpr int jump_buffer_ticks = tick_rate * 3 / 10;
 
+	// the handles are copied, the levels themselves are shared with them
+	// if none of the levels can be read the default level is played
 	template <std::ranges::range LevelRange>
 	game(const LevelRange &_levels);
 
 	// assumes ortho has been set and text has been set
-	void draw(const gl_instance &gl) const;
+	// batch must be built from the current level
+	// alpha in [0, 1] interpolates the player between its state before and after the last update
+	void draw(const gl_instance &gl, const level_cache &cache, float alpha = 1) const;
 	void update(float dt);
 
 	void move_right() { ++player.x_dir; }
@@ -33,15 +40,17 @@ public:
 	void jump()
 	{
 		player.do_jump = true;
-		player.jump_start = std::chrono::high_resolution_clock::now();
+		player.jump_ticks = 0;
 	}
 
 	void switch_colors();
 
 	std::size_t current_level() const { return cur_level; }
+	const level &get_level() const { return *cur; }
 
 private:
-	void load_level(std::size_t level);
+	// levels that can't be read are skipped, returns false and keeps the current level if none from level on can
+	bool load_level(std::size_t level);
 	void reset_level();
 
 	bool is_on(color c) const
@@ -49,10 +58,14 @@ private:
 		return c == color::neutral || (c == color::blue) == is_blue;
 	}
 	
-	std::vector<level> levels;
+	std::vector<level_handle> levels;
 	std::size_t cur_level;
+	// keeps the current level loaded while it's played
+	std::shared_ptr<const level> cur;
 
 	std::vector<std::pair<const block *, collision>> collisions;
+	// indices of the blocks near the player, filled from the level's index
+	std::vector<std::uint32_t> nearby_blocks;
 
 	struct player_data
 	{
@@ -63,13 +76,15 @@ private:
 		glm::vec2 accel;
 		float angle_vel;
 		float angle; // poly.angle is 0, this angle is what is drawn
+		glm::vec2 prev_offset; // poly.offset before the last update
+		float prev_angle; // angle before the last update
 		bool on_ground;
 		bool stopping_right; // if you're moving right but slowing down
 		bool stopping_left; // if you're moving left but slowing down
 		int x_dir; // > 0 for right, < 0 for left, 0 for still (reset to 0 after each update)
 		int on_wall; // > 0 for on right wall jump, < 0 for on left wall jump, 0 for not on wall
 		bool do_jump; // set to true when game::jump is called, false after jump initiated
-		std::chrono::high_resolution_clock::time_point jump_start; // time when jump was requested
+		int jump_ticks; // ticks since the jump was requested, counted by update so it doesn't depend on the wall clock or float error
 		bool intangible;
 	};
 
@@ -81,13 +96,12 @@ private:
 template <std::ranges::range LevelRange>
 game::game(const LevelRange &_levels) : levels{std::ranges::begin(_levels), std::ranges::end(_levels)}
 {
-	if (levels.empty())
-	{
-		level new_level;
-		new_level.construct_default();
-		levels.push_back(std::move(new_level));
-	}
+	if (!levels.empty() && load_level(0))
+		return;
 
+	level new_level;
+	new_level.construct_default();
+	levels.assign(1, level_handle(std::move(new_level)));
 	load_level(0);
 }
 
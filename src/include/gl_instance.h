@@ -12,6 +12,11 @@
 
 static constexpr int pos_attribute = 0;
 static constexpr int text_pos_attribute = 1;
+// per instance attributes of the instanced texture program
+static constexpr int instance_basis_attribute = 2;
+static constexpr int instance_offset_attribute = 3;
+static constexpr int instance_layers_attribute = 4;
+static constexpr int instance_color_attribute = 5;
 
 constexpr int target_width = 960;
 constexpr int target_height = 540;
@@ -30,6 +35,10 @@ struct shapes
         return m_buffers.triangle_vao;
     }
 
+    // sets up the position and texture coordinate attributes of another vao (bound by this call) from the shape buffers
+    void attach_square(const vao &v) const;
+    void attach_triangle(const vao &v) const;
+
 private:
     friend class gl_instance;
 
@@ -60,12 +69,17 @@ public:
     gl_instance& operator=(const gl_instance &) = delete;
 
     static void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+    // the window was uncovered or otherwise needs its contents drawn again, screens that only draw on changes rely on it
+    static void window_refresh_callback(GLFWwindow* window);
 
     const window &get_window() const { return m_window; }
     const shapes &get_shapes() const { return m_shapes; }
     const shader &get_texture_program() const { return m_texture_program; }
     const shader &get_text_program() const { return m_text_program; }
     const shader &get_shape_program() const { return m_shape_program; }
+    const shader &get_instanced_texture_program() const { return m_instanced_texture_program; }
+    // texture program sampling one layer of a texture array
+    const shader &get_layer_texture_program() const { return m_layer_texture_program; }
     const game_assets &get_assets() const { return m_assets; }
     const glm::mat4 &get_ortho() const { return m_ortho; }
     font &get_font() { return m_font; }
@@ -78,7 +92,7 @@ public:
     // adjusted for dpi
     glm::ivec2 viewport_size() const { return m_size; }
 
-    // for continuous drawing while resizing window
+    // for continuous drawing while resizing window and redrawing when the window is refreshed
     void register_draw_function(std::function<void()> draw) { m_draw = std::move(draw); }
 
 private:
@@ -89,11 +103,15 @@ private:
     };
 
     glfw_instance m_glfw;
+    // right after glfw, which it needs for the monitor's content scale, so the images decode while everything after it is set up
+    game_assets::loader m_asset_loader;
     window m_window;
     shapes m_shapes;
     shader m_texture_program;
     shader m_text_program;
     shader m_shape_program;
+    shader m_instanced_texture_program;
+    shader m_layer_texture_program;
     game_assets m_assets;
     glm::mat4 m_ortho;
     font m_font;
@@ -105,12 +123,23 @@ private:
     key m_escape;
 };
 
+// registers draw and clears whatever draw function is registered when it goes out of scope
+// draw functions capture the locals of the screen that registers them, so one must never outlive that screen
+class scoped_draw_function
+{
+public:
+    scoped_draw_function(gl_instance &gl, std::function<void()> draw) : m_gl(gl) { m_gl.register_draw_function(std::move(draw)); }
+    ~scoped_draw_function() { m_gl.register_draw_function({}); }
+
+    scoped_draw_function(const scoped_draw_function &) = delete;
+    scoped_draw_function &operator=(const scoped_draw_function &) = delete;
+
+private:
+    gl_instance &m_gl;
+};
+
 glm::dvec2 get_mouse_pos(gl_instance &gl);
 // set ortho model in texture program before
 void print_background(const gl_instance &gl);
 
-const polygon &square();
-// constexpr float triangle_poly_width = .8f;
-const polygon &triangle();
-
 #endif
\ No newline at end of file
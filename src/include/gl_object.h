@@ -3,7 +3,11 @@
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <array>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -44,6 +48,19 @@ struct window
 	GLFWwindow *handle;
 };
 
+// every uniform the program set from c++, used as handles so setting one never looks it up by name
+// each program resolves the locations of the ones it has once when it's linked
+enum class uniform
+{
+	ortho,
+	model,
+	transparency,
+	layer,
+	active_color,
+	color,
+	count,
+};
+
 struct shader
 {
 	shader() : id{} {}
@@ -117,12 +134,17 @@ struct shader
 
 			std::cerr << message << '\n';
 		}
+
+		static constexpr const char *uniform_names[] = {"ortho", "model", "transparency", "layer", "active_color", "color"};
+		static_assert(std::size(uniform_names) == static_cast<std::size_t>(uniform::count));
+		for (std::size_t i = 0; i < m_uniforms.size(); ++i)
+			m_uniforms[i].location = glGetUniformLocation(id, uniform_names[i]);
 	}
 
 	shader(const shader &) = delete;
 	shader &operator=(const shader &) = delete;
 
-	shader(shader &&other) : id{ other.id }
+	shader(shader &&other) : id{ other.id }, m_uniforms{std::move(other.m_uniforms)}
 	{
 		other.id = 0;
 	}
@@ -131,6 +153,7 @@ struct shader
 	{
 		glDeleteProgram(id);
 		id = other.id;
+		m_uniforms = std::move(other.m_uniforms);
 		other.id = 0;
 
 		return *this;
@@ -142,7 +165,53 @@ struct shader
 		id = 0;
 	}
 
+	// the setters assume this program is in use
+	// a value is only uploaded if it's different from the last one set, uniforms the program doesn't have are ignored
+	void set(uniform u, int value) const
+	{
+		if (GLint location = changed(u, &value, sizeof(value)); location >= 0)
+			glUniform1i(location, value);
+	}
+	void set(uniform u, float value) const
+	{
+		if (GLint location = changed(u, &value, sizeof(value)); location >= 0)
+			glUniform1f(location, value);
+	}
+	void set(uniform u, const glm::vec4 &value) const
+	{
+		if (GLint location = changed(u, &value, sizeof(value)); location >= 0)
+			glUniform4fv(location, 1, &value[0]);
+	}
+	void set(uniform u, const glm::mat4 &value) const
+	{
+		if (GLint location = changed(u, &value, sizeof(value)); location >= 0)
+			glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
+	}
+
 	GLuint id;
+
+private:
+	struct cached_uniform
+	{
+		GLint location = -1;
+		std::size_t size = 0; // bytes of value, 0 if nothing has been set yet
+		unsigned char value[sizeof(glm::mat4)];
+	};
+
+	// returns the location if the value needs uploading and remembers the new value, -1 otherwise
+	GLint changed(uniform handle, const void *value, std::size_t size) const
+	{
+		auto &u = m_uniforms[static_cast<std::size_t>(handle)];
+		if (u.location < 0 || (u.size == size && std::memcmp(u.value, value, size) == 0))
+			return -1;
+
+		u.size = size;
+		std::memcpy(u.value, value, size);
+		return u.location;
+	}
+
+	// uniforms are program state, so the cached values stay valid while other programs are used
+	mutable std::array<cached_uniform, static_cast<std::size_t>(uniform::count)> m_uniforms;
 };
 
 struct vao
@@ -259,8 +328,8 @@ struct texture
 
 		glGenTextures(1, &id);
 		glBindTexture(GL_TEXTURE_2D, id);
+		// only sampled with GL_NEAREST, so no mipmaps
 		glTexImage2D(GL_TEXTURE_2D, 0, target_format, width, height, 0, pixel_format, GL_UNSIGNED_BYTE, data);
-		glGenerateMipmap(GL_TEXTURE_2D);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
@@ -306,6 +375,172 @@ struct texture
 	GLsizei width, height;
 };
 
+// layers of equal size, sampled with a sampler2DArray
+struct texture_array
+{
+	texture_array() : width{}, height{}, layers{}
+	{
+		glGenTextures(1, &id);
+	}
+
+	texture_array(GLsizei _width, GLsizei _height, GLsizei _layers) : width{_width}, height{_height}, layers{_layers}
+	{
+		glGenTextures(1, &id);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+		glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, width, height, layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+		static float border_col[4]{0, 0, 0, 0};
+		glTexParameterfv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, border_col);
+	}
+
+	// data is resized to width by height (nearest neighbor) and converted to rgba, ready for upload_layer
+	// a target_format of GL_RGB drops the alpha channel, like it does for texture
+	// doesn't touch opengl, so it can be done on any thread
+	static std::vector<unsigned char> convert(GLsizei width, GLsizei height, GLenum target_format, const void *data, GLsizei data_width, GLsizei data_height, int channel_count)
+	{
+		if (channel_count < 1 || channel_count > 4)
+			return {};
+
+		const unsigned char *in = reinterpret_cast<const unsigned char *>(data);
+		std::vector<unsigned char> pixels(static_cast<std::size_t>(width) * height * 4);
+
+		for (GLsizei y = 0; y < height; ++y)
+		{
+			const unsigned char *row = in + static_cast<std::size_t>(y * data_height / height) * data_width * channel_count;
+			for (GLsizei x = 0; x < width; ++x)
+			{
+				const unsigned char *src = row + static_cast<std::size_t>(x * data_width / width) * channel_count;
+				unsigned char *dst = pixels.data() + (static_cast<std::size_t>(y) * width + x) * 4;
+
+				// single channel images are grayscale
+				dst[0] = src[0];
+				dst[1] = channel_count > 1 ? src[1] : src[0];
+				dst[2] = channel_count > 2 ? src[2] : src[0];
+				dst[3] = channel_count > 3 && target_format != GL_RGB ? src[3] : 255;
+			}
+		}
+
+		return pixels;
+	}
+
+	void set_layer(GLsizei layer, GLenum target_format, const void *data, GLsizei data_width, GLsizei data_height, int channel_count)
+	{
+		auto pixels = convert(width, height, target_format, data, data_width, data_height, channel_count);
+		if (!pixels.empty())
+			upload_layer(layer, pixels.data());
+	}
+
+	// pixels is width * height rgba, or an offset into the bound pixel unpack buffer
+	void upload_layer(GLsizei layer, const void *pixels)
+	{
+		if (layer >= layers)
+			return;
+
+		glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	}
+
+	~texture_array()
+	{
+		glDeleteTextures(1, &id);
+		width = height = layers = 0;
+		id = 0;
+	}
+
+	texture_array(const texture_array &) = delete;
+	texture_array &operator=(const texture_array &) = delete;
+
+	texture_array(texture_array &&other) : id{other.id}, width{other.width}, height{other.height}, layers{other.layers}
+	{
+		other.id = 0;
+		other.width = other.height = other.layers = 0;
+	}
+
+	texture_array &operator=(texture_array &&other)
+	{
+		glDeleteTextures(1, &id);
+		id = other.id;
+		width = other.width;
+		height = other.height;
+		layers = other.layers;
+
+		other.id = 0;
+		other.width = other.height = other.layers = 0;
+
+		return *this;
+	}
+
+	GLuint id;
+	GLsizei width, height, layers;
+};
+
+// renders into a color texture
+struct framebuffer
+{
+	framebuffer() : width{}, height{}
+	{
+		glGenFramebuffers(1, &id);
+		glGenTextures(1, &color);
+	}
+
+	// reallocates the color texture, its contents are undefined until drawn to again
+	void resize(GLsizei _width, GLsizei _height)
+	{
+		width = _width;
+		height = _height;
+
+		glBindTexture(GL_TEXTURE_2D, color);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, id);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			std::cerr << "framebuffer incomplete\n";
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
+
+	~framebuffer()
+	{
+		glDeleteFramebuffers(1, &id);
+		glDeleteTextures(1, &color);
+		width = height = 0;
+		id = color = 0;
+	}
+
+	framebuffer(const framebuffer &) = delete;
+	framebuffer &operator=(const framebuffer &) = delete;
+
+	framebuffer(framebuffer &&other) : id{other.id}, color{other.color}, width{other.width}, height{other.height}
+	{
+		other.id = other.color = 0;
+		other.width = other.height = 0;
+	}
+
+	framebuffer &operator=(framebuffer &&other)
+	{
+		glDeleteFramebuffers(1, &id);
+		glDeleteTextures(1, &color);
+		id = other.id;
+		color = other.color;
+		width = other.width;
+		height = other.height;
+
+		other.id = other.color = 0;
+		other.width = other.height = 0;
+
+		return *this;
+	}
+
+	GLuint id;
+	GLuint color;
+	GLsizei width, height;
+};
+
 using vbo = buffer;
 using ebo = buffer;
 using ubo = buffer;
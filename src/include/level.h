@@ -4,9 +4,16 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <string>
 #include <filesystem>
+#include <vector>
+#include <span>
+#include <optional>
+#include <utility>
+#include <cstdint>
 
 #include "collision.h"
-#include "gl_instance.h"
+
+// rendering lives in level_draw.cpp, which isn't part of mapjump_core
+class gl_instance;
 
 enum class color : char
 {
@@ -38,16 +45,41 @@ struct block
 	// dir is direction the block is facing
 	block(glm::ivec2 grid_loc, type _block_type, color _block_color, direction dir);
 
-	// assumes ortho has been set and text has been set
+	// assumes the layer texture program is in use and its ortho has been set
 	void draw(color active_color, const gl_instance &gl, float transparency = 1) const;
 
 	direction dir() const;
 
 	polygon_view poly;
+	// world space shape of poly, blocks never move so this is computed once in the constructor
+	baked_polygon shape;
 	type block_type;
 	color block_color;
 };
 
+// uniform grid of block cells, used to find the blocks near an area without scanning the whole level
+// only occupied cells are stored, so blocks far apart don't cost anything for the empty cells between them
+class block_grid
+{
+public:
+	void build(const std::vector<block> &blocks);
+
+	// appends the indices of blocks in any cell overlapped by the box [min, max] to out
+	// indices are appended in the order the blocks appear in the level
+	void query(glm::vec2 min, glm::vec2 max, std::vector<std::uint32_t> &out) const;
+
+	// cells with at least one block, the only ones stored
+	std::size_t cell_count() const { return m_keys.size(); }
+
+private:
+	static std::uint64_t key(glm::ivec2 cell) { return static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.y)) << 32 | static_cast<std::uint32_t>(cell.x); }
+
+	// occupied cells sorted by key, blocks in m_keys[i] are m_indices[m_cell_start[i]] to m_indices[m_cell_start[i + 1]]
+	std::vector<std::uint64_t> m_keys;
+	std::vector<std::uint32_t> m_cell_start;
+	std::vector<std::uint32_t> m_indices;
+};
+
 struct level
 {
 	std::vector<block> blocks;
@@ -55,15 +87,30 @@ struct level
 	glm::ivec2 end;
 	bool blue_starts;
 
+	// only valid for the blocks as they were at the last call to build_index
+	block_grid index;
+
 	void construct_default();
-	// assumes ortho has been set and text has been set
+	// must be called after modifying blocks
+	void build_index() { index.build(blocks); }
+	// assumes the layer texture program is in use and its ortho has been set
 	void draw(color active_color, const gl_instance &gl) const;
 
+	// throws std::runtime_error if the file can't be read or isn't a valid level
 	void read_level(const std::filesystem::path &filename);
-	void write_level(const std::filesystem::path &filename);
+	// same as above for the contents of a .lvl file already in memory
+	void read_level(std::span<const unsigned char> data);
+	// the contents of a .lvl file for this level
+	std::vector<unsigned char> encode() const;
+	// replaces the file atomically, see write_file in mapped_file.h
+	void write_level(const std::filesystem::path &filename) const;
 };
 
-// pass in directory to level_location to load multiple levels, or a single file to load one level
-// the levels in a directory must be of the format "levelName_*levelNumber*.lvl". level numbers are sorted by *levelNumber*
-std::vector<level> get_levels(const std::filesystem::path &location);
+// levelNumber of a file named "levelName_*levelNumber*.lvl", empty for any other name
+std::optional<unsigned int> level_number(const std::filesystem::path &filename);
+
+// the level files in directory named "levelName_*levelNumber*.lvl" with their numbers, sorted by number
+// doesn't throw, anything that can't be listed or has a .lvl extension without a number is skipped and described in errors
+std::vector<std::pair<unsigned int, std::filesystem::path>> level_files(const std::filesystem::path &directory, std::vector<std::string> *errors = nullptr);
+
 #endif
\ No newline at end of file
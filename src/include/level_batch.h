@@ -0,0 +1,41 @@
+#ifndef LEVEL_BATCH_H
+#define LEVEL_BATCH_H
+
+#include "gl_object.h"
+#include "level.h"
+
+#include <vector>
+
+// instance buffer of every block in a level, grouped by shape so the level draws in one call per shape
+// each instance carries its off and on layers of the blocks texture array, the shader picks one from the active color
+// build once per level, the level isn't referenced after construction
+class level_batch
+{
+public:
+	level_batch() = default;
+	level_batch(const gl_instance &gl, const level &l);
+
+	// assumes ortho has been set, leaves the instanced texture program in use
+	void draw(color active_color, const gl_instance &gl, float transparency = 1) const;
+
+private:
+	struct instance
+	{
+		glm::vec4 basis; // columns of the rotation and scale
+		glm::vec2 offset;
+		GLint layers[2]; // off, on
+		GLint block_color;
+	};
+
+	struct group
+	{
+		bool triangle;
+		GLsizei count;
+		vao buff; // shape attributes plus this group's range of the instance buffer
+	};
+
+	vbo m_instances;
+	std::vector<group> m_groups;
+};
+
+#endif
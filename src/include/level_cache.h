@@ -0,0 +1,31 @@
+#ifndef LEVEL_CACHE_H
+#define LEVEL_CACHE_H
+
+#include "gl_object.h"
+#include "level_batch.h"
+
+// the background and blocks of a level, drawn once per color state into offscreen framebuffers
+// a frame only copies the active one to the screen, they're redrawn when the viewport changes size
+// build once per level, like level_batch
+class level_cache
+{
+public:
+	level_cache() = default;
+	level_cache(const gl_instance &gl, const level &l) : m_batch(gl, l) {}
+
+	// assumes the framebuffer being drawn to is the default one
+	void draw(color active_color, const gl_instance &gl) const;
+
+private:
+	struct layer
+	{
+		framebuffer target;
+		bool valid = false;
+	};
+
+	level_batch m_batch;
+	// blue, red
+	mutable layer m_layers[2];
+};
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef LEVEL_GRID_H
+#define LEVEL_GRID_H
+
+#include "level.h"
+#include "game.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// the blocks of a level stored by cell for the level editor, finding, placing and removing a block only looks at one cell
+// a cell holds a normal or jump block, or up to one spike facing each direction
+// blocks outside the map are kept but can't be edited
+// every block keeps its place in the level's order, so collisions resolve the same after saving, new blocks go after the rest
+class level_grid
+{
+public:
+	static constexpr int width = game::map_width;
+	static constexpr int height = game::map_height;
+
+	level_grid() : m_cells(width * height) {}
+	// blocks that can't share a cell are shown as the later one, like placing them in order
+	// the hidden ones are still written until their cell is edited, so an unchanged level is saved unchanged
+	explicit level_grid(const level &l);
+
+	static bool in_bounds(glm::ivec2 cell) { return cell.x >= 0 && cell.x < width && cell.y >= 0 && cell.y < height; }
+
+	// the block under a small square around loc (world space), null if there's none
+	const block *find(glm::vec2 loc) const;
+	// removes what b overlaps in its cell, everything for a normal or jump block, or a normal or jump block and the spike facing the same way for a spike
+	// b takes the place in the order of the block it replaces in the same slot, or goes last
+	void place(const block &b);
+	// removes the block find would return, returns false if there wasn't one
+	bool remove(glm::vec2 loc);
+	// removes every block in cell
+	void clear(glm::ivec2 cell);
+
+	// the cell of the block find would return, empty if there's none
+	std::optional<glm::ivec2> find_cell(glm::vec2 loc) const;
+
+	// everything in a cell packed into 18 bits, a bit per used slot, the type, color and direction of the normal or jump block
+	// and the color of each spike, unused slots are 0 so cells with the same blocks have the same state
+	using cell_state = std::uint32_t;
+	static constexpr int cell_state_bits = 18;
+
+	// cell must be in bounds
+	cell_state state(glm::ivec2 cell) const;
+	// a slot that held a block before gets its place in the order back, so undo and redo restore the order too
+	void set_state(glm::ivec2 cell, cell_state s);
+
+	// cells covered by the editor's shape tools, only ones in bounds
+	// every cell of the rectangle with corners a and b
+	static std::vector<glm::ivec2> rect_cells(glm::ivec2 a, glm::ivec2 b);
+	// a line from a to b with one cell per step along its longer axis
+	static std::vector<glm::ivec2> line_cells(glm::ivec2 a, glm::ivec2 b);
+	// start and the cells connected to it by edges that have the same blocks as it
+	std::vector<glm::ivec2> flood_cells(glm::ivec2 start) const;
+
+	// replaces the blocks of l, in order, and rebuilds its index
+	void write(level &l) const;
+
+	template <typename F>
+	void for_each(F &&f) const
+	{
+		for (const auto &c : m_cells)
+			for (int i = 0; i < slot_count; ++i)
+				if (c.used & 1 << i)
+					f(c.slots[i]);
+		for (const auto &b : m_outside)
+			f(b.second);
+	}
+
+private:
+	// slot 0 is a normal or jump block, slot 1 + direction a spike
+	static constexpr int slot_count = 5;
+
+	// place in the level's order, the original index for blocks that were read and counting up from there for new ones
+	using sequence = std::uint32_t;
+	static constexpr sequence no_sequence = ~sequence{0};
+
+	struct cell
+	{
+		std::array<block, slot_count> slots;
+		// kept after a slot is emptied so undo can restore it
+		std::array<sequence, slot_count> order;
+		std::uint8_t used = 0; // bit per slot
+
+		cell() { order.fill(no_sequence); }
+	};
+
+	static int slot(const block &b) { return b.block_type == block::type::spike ? 1 + static_cast<int>(b.dir()) : 0; }
+
+	cell &at(glm::ivec2 c) { return m_cells[static_cast<std::size_t>(c.y) * width + c.x]; }
+	const cell &at(glm::ivec2 c) const { return m_cells[static_cast<std::size_t>(c.y) * width + c.x]; }
+
+	// the cell and slot of the block find returns, slot is -1 if there's none
+	std::pair<glm::ivec2, int> find_slot(glm::vec2 loc) const;
+
+	// hidden is given what b replaces instead of it being dropped
+	void place(const block &b, sequence order, std::vector<std::pair<sequence, block>> *hidden);
+	// the hidden blocks of an edited cell are dropped
+	void edited(glm::ivec2 c);
+
+	std::vector<cell> m_cells;
+	std::vector<std::pair<sequence, block>> m_outside;
+	// blocks of the level that didn't fit next to later blocks in their cell
+	std::vector<std::pair<sequence, block>> m_hidden;
+	sequence m_next = 0;
+};
+
+#endif
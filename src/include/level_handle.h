@@ -0,0 +1,63 @@
+#ifndef LEVEL_HANDLE_H
+#define LEVEL_HANDLE_H
+
+#include "level.h"
+
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class level_pack;
+
+// a level that's only read when it's used, copies of a handle share the level
+// the parsed level is kept while anything holds the pointer returned by get, after that it's read again on the next get
+class level_handle
+{
+public:
+	// the level in a .lvl file
+	explicit level_handle(std::filesystem::path filename);
+	// the first of filenames that can be read, such as every file with the same level number
+	explicit level_handle(std::vector<std::filesystem::path> filenames);
+	// level index of pack
+	level_handle(std::shared_ptr<const level_pack> pack, std::size_t index);
+	// a level that's already loaded, such as the one being edited
+	explicit level_handle(level l);
+
+	// blocks until the level is read, null if it can't be read
+	// a level that failed isn't read again
+	std::shared_ptr<const level> get() const;
+	// starts reading the level on another thread, the next get waits for it instead of reading it again
+	void prefetch() const;
+
+private:
+	struct state
+	{
+		// null if nothing could be read
+		std::shared_ptr<const level> read() const;
+
+		std::vector<std::filesystem::path> filenames;
+		std::shared_ptr<const level_pack> pack;
+		std::size_t index = 0;
+
+		std::mutex mutex;
+		std::weak_ptr<const level> loaded;
+		// levels that aren't read from anywhere are held here for good
+		std::shared_ptr<const level> owned;
+		bool unreadable = false;
+		// last so it's destroyed first, waiting for a prefetch that's still reading from the members above
+		std::future<std::shared_ptr<const level>> pending;
+	};
+
+	std::shared_ptr<state> m_state;
+};
+
+// pass in directory to level_location to load multiple levels, a .lvlpack to load every level in it, or a single file to load one level
+// the levels in a directory must be of the format "levelName_*levelNumber*.lvl". level numbers are sorted by *levelNumber*
+// nothing is read until a level is used, a level that turns out to be unreadable is skipped by game when it's reached
+// doesn't throw, what couldn't be listed is described in errors and if nothing is found the default level is used
+std::vector<level_handle> get_levels(const std::filesystem::path &location, std::vector<std::string> *errors = nullptr);
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef LEVEL_PACK_H
+#define LEVEL_PACK_H
+
+#include "level.h"
+#include "mapped_file.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+// many levels in one .lvlpack file, any level can be read without reading the others
+// layout: header tag, u32 version, u32 level count, then per level u64 offset and u64 size from the start of the file,
+// then the contents of each level's .lvl file
+class level_pack
+{
+public:
+	level_pack() = default;
+	// throws std::runtime_error if the file can't be read or its index is invalid
+	explicit level_pack(const std::filesystem::path &filename);
+
+	std::size_t size() const { return m_index.size(); }
+
+	// the .lvl file contents of level i
+	std::span<const unsigned char> level_data(std::size_t i) const;
+	// throws std::runtime_error like level::read_level if level i is invalid
+	level get(std::size_t i) const;
+
+	// each level is the contents of a .lvl file, they are stored in the order given
+	// the file is replaced atomically with write_file
+	static void write(const std::filesystem::path &filename, const std::vector<std::span<const unsigned char>> &levels);
+
+private:
+	struct entry
+	{
+		std::uint64_t offset;
+		std::uint64_t size;
+	};
+
+	mapped_file m_file;
+	// copied out of the file so the entries are aligned, every entry is checked to be within the file
+	std::vector<entry> m_index;
+};
+
+#endif
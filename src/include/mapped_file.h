@@ -0,0 +1,43 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+// read only view of a whole file mapped into memory, the file is never copied into a buffer
+// throws std::runtime_error if the file can't be opened or mapped
+class mapped_file
+{
+public:
+	mapped_file() : m_data{}, m_size{}, m_handle{}, m_mapping{} {}
+	explicit mapped_file(const std::filesystem::path &filename);
+	~mapped_file() { close(); }
+
+	mapped_file(const mapped_file &) = delete;
+	mapped_file &operator=(const mapped_file &) = delete;
+
+	mapped_file(mapped_file &&other) noexcept;
+	mapped_file &operator=(mapped_file &&other) noexcept;
+
+	// null for an empty file
+	const unsigned char *data() const { return m_data; }
+	std::size_t size() const { return m_size; }
+
+private:
+	void close();
+
+	const unsigned char *m_data;
+	std::size_t m_size;
+	// only used on windows, the mapping of a posix file outlives its descriptor
+	void *m_handle;
+	void *m_mapping;
+};
+
+// replaces filename with data, which is written to filename.tmp, flushed to disk and then renamed over filename
+// so a crash or full disk leaves either the old file or the new one, never a partial file
+// on posix the new file gets the old file's permissions
+// throws std::runtime_error if anything fails, the old file is left as it was
+void write_file(const std::filesystem::path &filename, std::span<const unsigned char> data);
+
+#endif
@@ -2,6 +2,7 @@
 #define MESSAGES_H
 #include "gl_instance.h"
 #include "button.h"
+#include <span>
 #include <string>
 #include <vector>
 
@@ -12,12 +13,16 @@ public:
     
     // returns size() on escape pressed
     // extra draw is called for any additional rendering needed. Don't call glfwSwapBuffers in draw function
+    // the menu is only drawn again when the highlighted button changes or the window is resized or refreshed
     std::size_t run(gl_instance &gl, std::function<void()> extra_draw = {}) const;
     std::size_t size() const { return m_options.size(); }
 private:
     std::vector<button> m_options;
 };
 
+// index of the button under mouse_pos, buttons.size() if there's none
+std::size_t button_under(std::span<const button> buttons, glm::vec2 mouse_pos);
+
 bool yes_no(gl_instance &gl, const std::string &message);
 void message(gl_instance &gl, const std::string &message);
 #endif
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef QOI_H
+#define QOI_H
+
+#include <cstddef>
+#include <vector>
+
+// decoder for the "quite ok image" format the asset compiler embeds images as
+// throws std::runtime_error if data isn't a valid image
+struct qoi_image
+{
+	int width;
+	int height;
+	int channels;
+	std::vector<unsigned char> pixels; // rows in the order they were encoded
+};
+
+qoi_image qoi_decode(const void *data, std::size_t size);
+
+#endif
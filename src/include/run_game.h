@@ -2,15 +2,34 @@
 #define RUN_GAME_H
 
 #include "gl_object.h"
+#include "gl_instance.h"
 #include "game.h"
+#include "level_cache.h"
+#include "frame_pacer.h"
 #include "utility.h"
+#include "text.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#ifdef MAPJUMP_DEBUG
+#include <iostream>
+#endif
 
 // returns current level
+// V switches pacing between sleeping and vsync, the choice is written back to pacing so it carries over to the next run
+// F3 shows the mean frame time and jitter
 template <std::ranges::range LevelRange>
-std::size_t run_game(gl_instance &gl, const LevelRange &levels)
+std::size_t run_game(gl_instance &gl, const LevelRange &levels, frame_pacer::mode &pacing)
 {
-	constexpr int target_fps = 60;
-	constexpr auto target_frame_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(1.0 / target_fps));
+	// the simulation always steps at game::tick_rate, independent of how often frames are drawn
+	constexpr float tick_duration = 1.f / game::tick_rate;
+	// most ticks to run in one frame, any time past this is dropped so a long stall doesn't snowball
+	constexpr int max_ticks_per_frame = 5;
+
+	// only used when not pacing with vsync
+	constexpr int target_fps = 144;
 
 	const auto &program = gl.get_texture_program();
 	const auto &win = gl.get_window();
@@ -20,6 +39,18 @@ std::size_t run_game(gl_instance &gl, const LevelRange &levels)
 
 	game my_game(levels);
 
+	// rebuilt whenever the game moves to another level
+	level_cache cache(gl, my_game.get_level());
+	std::size_t cache_level = my_game.current_level();
+
+	// simulated time owed to the game, always less than tick_duration after the ticks for a frame have run
+	float accumulator = 0;
+
+	// frame stats, refreshed a few times a second while shown
+	text stats(gl.get_font());
+	bool stats_shown = false;
+	auto next_stats = std::chrono::steady_clock::now();
+
 	auto draw = [&]()
 	{
 		glClearColor(1, 1, 1, 1);
@@ -27,20 +58,33 @@ std::size_t run_game(gl_instance &gl, const LevelRange &levels)
 
 		// set uniforms
 		glUseProgram(program.id);
-		glUniformMatrix4fv(glGetUniformLocation(program.id, "ortho"), 1, GL_FALSE, &gl.get_ortho()[0][0]);
+		program.set(uniform::ortho, gl.get_ortho());
 
-		my_game.draw(gl);
+		my_game.draw(gl, cache, accumulator / tick_duration);
+
+		if (stats_shown)
+			stats.draw(gl);
 
 		glfwSwapBuffers(win.handle);
 	};
 
-	gl.register_draw_function(draw);
+	scoped_draw_function registration(gl, draw);
 
 	key space;
+	key switch_pacing;
+	key show_stats;
+
+	frame_pacer pacer(pacing, target_fps);
+
+	auto last_frame = std::chrono::steady_clock::now();
 
 	while (!glfwWindowShouldClose(win.handle))
 	{
+		pacer.begin_frame();
+
 		std::chrono::time_point frame_begin = std::chrono::steady_clock::now();
+		accumulator += std::chrono::duration<float>(frame_begin - last_frame).count();
+		last_frame = frame_begin;
 
 		glfwPollEvents();
 
@@ -48,10 +92,6 @@ std::size_t run_game(gl_instance &gl, const LevelRange &levels)
 
 		if (gl.get_escape_key().is_initial_press())
 			break;
-		if (glfwGetKey(win.handle, GLFW_KEY_A))
-			my_game.move_left();
-		if (glfwGetKey(win.handle, GLFW_KEY_D))
-			my_game.move_right();
         
         space.update(glfwGetKey(win.handle, GLFW_KEY_SPACE));
         gl.get_left_click().update(glfwGetMouseButton(win.handle, GLFW_MOUSE_BUTTON_LEFT));
@@ -61,20 +101,82 @@ std::size_t run_game(gl_instance &gl, const LevelRange &levels)
 		if (gl.get_left_click().is_initial_press())
 			my_game.switch_colors();
 
-		my_game.update(1.f / target_fps);
+		switch_pacing.update(glfwGetKey(win.handle, GLFW_KEY_V));
+		if (switch_pacing.is_initial_press())
+		{
+			pacing = pacing == frame_pacer::mode::sleep ? frame_pacer::mode::vsync : frame_pacer::mode::sleep;
+			pacer.set_mode(pacing);
+			next_stats = frame_begin;
+		}
 
-		draw();
+		show_stats.update(glfwGetKey(win.handle, GLFW_KEY_F3));
+		if (show_stats.is_initial_press())
+		{
+			stats_shown = !stats_shown;
+			next_stats = frame_begin;
+		}
 
-		auto frame_duration = std::chrono::steady_clock::now() - frame_begin;
-		if (frame_duration < target_frame_duration)
+		if (stats_shown && frame_begin >= next_stats)
 		{
-			auto sleep_time = target_frame_duration - frame_duration;
-			auto start = std::chrono::steady_clock::now();
-			while (std::chrono::steady_clock::now() - start < sleep_time);
+			using namespace std::chrono_literals;
+			next_stats = frame_begin + 250ms;
+
+			char buffer[96];
+			std::snprintf(buffer, sizeof(buffer), "%s  %.2f ms  jitter %.2f ms", pacer.get_mode() == frame_pacer::mode::vsync ? "vsync" : "sleep",
+				pacer.mean_frame_time() * 1000, pacer.jitter() * 1000);
+			stats.set_string(std::string(buffer));
+			stats.set_text_scale({1, 1});
+
+			static constexpr float height = 16.f;
+			rect bound = stats.get_local_rect();
+			float scale_diff = height / bound.dims.y;
+			stats.set_text_scale({scale_diff, scale_diff});
+			stats.set_text_origin(glm::vec2{10, target_height - 10 - height} - bound.min * scale_diff);
 		}
+
+		bool left = glfwGetKey(win.handle, GLFW_KEY_A);
+		bool right = glfwGetKey(win.handle, GLFW_KEY_D);
+
+		int ticks = 0;
+		for (; accumulator >= tick_duration && ticks < max_ticks_per_frame; ++ticks)
+		{
+			// movement is reset after every update, so held keys apply to each tick
+			if (left)
+				my_game.move_left();
+			if (right)
+				my_game.move_right();
+
+			my_game.update(tick_duration);
+			accumulator -= tick_duration;
+		}
+
+		if (ticks == max_ticks_per_frame && accumulator >= tick_duration)
+			accumulator = std::fmod(accumulator, tick_duration);
+
+		if (my_game.current_level() != cache_level)
+		{
+			cache = level_cache(gl, my_game.get_level());
+			cache_level = my_game.current_level();
+		}
+
+		draw();
+
+		pacer.end_frame();
 	}
 
+#ifdef MAPJUMP_DEBUG
+	std::cout << "frame time " << pacer.mean_frame_time() * 1000 << " ms, jitter " << pacer.jitter() * 1000 << " ms\n";
+#endif
+
     return my_game.current_level();
 }
 
+// paced by sleeping
+template <std::ranges::range LevelRange>
+std::size_t run_game(gl_instance &gl, const LevelRange &levels)
+{
+	frame_pacer::mode pacing = frame_pacer::mode::sleep;
+	return run_game(gl, levels, pacing);
+}
+
 #endif
\ No newline at end of file
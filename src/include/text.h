@@ -2,6 +2,7 @@
 #define TEXT_H
 #include "gl_object.h"
 #include <unordered_map>
+#include <vector>
 #include <glm/mat4x4.hpp>
 
 #include "rect.h"
@@ -49,35 +50,40 @@ private:
 
 	struct character
 	{
-		character() : text{}, offset{}, advance{}, height{} {}
-
-		character(const font *_font, uint32_t c);
-		~character() = default;
-
-		// dummy functions to enable use with std::map
-		character(const character &other);
-		character &operator=(const character &other);
-
-		character(character &&other);
-		character &operator=(character &&other);
+		glm::ivec2 offset;
+		glm::ivec2 size; // of the bitmap
+		glm::ivec2 atlas_pos; // texel of the bottom left of the bitmap in the atlas
+		unsigned int advance;
+		unsigned int height;
+	};
 
-		void load(const font *_font, uint32_t c);
+	// every loaded glyph packed into rows of one single channel texture, which doubles in height when full
+	// texture coordinates are in texels so text built before the atlas grew stays valid
+	struct glyph_atlas
+	{
+		static constexpr GLsizei width = 2048;
+		static constexpr int padding = 2;
 
 		texture text;
+		std::vector<unsigned char> pixels; // copy of the texture to upload again when it grows
+		glm::ivec2 cursor{padding, padding};
+		int row_height = 0;
 
-		glm::ivec2 offset;
-		unsigned int advance;
-		unsigned int height;
+		// returns where the bitmap was put, rows are flipped so the atlas is bottom up
+		glm::ivec2 add(const unsigned char *bitmap, int bitmap_width, int bitmap_height, int pitch);
 	};
 
+	character load_character(uint32_t c) const;
+
 	character const *at(uint32_t c) const
 	{
-		if (!m_chars.count(c))
-			return &m_chars.emplace(c, character{this, c}).first->second;
-		return &m_chars.at(c);
+		if (auto it = m_chars.find(c); it != m_chars.end())
+			return &it->second;
+		return &m_chars.emplace(c, load_character(c)).first->second;
 	}
 
 	// mutable to allow potential addition of new characters in draw function
+	mutable glyph_atlas m_atlas;
 	mutable std::unordered_map<uint32_t, character> m_chars;
 };
 
@@ -87,45 +93,76 @@ public:
 	text() : m_origin{},
 			 m_scale{1, 1},
 			 m_font{},
-			 m_data{}
+			 m_data{},
+			 m_vertex_count{},
+			 m_dirty{true}
 	{
 	}
 	text(font &_font) : m_origin{},
 						m_scale{1, 1},
 						m_font{&_font},
-						m_data{}
+						m_data{},
+						m_vertex_count{},
+						m_dirty{true}
 	{
 	}
 	template <typename CharT = char>
 	text(const std::basic_string<CharT> &txt, font &_font) : m_origin{},
 														  m_scale{1, 1},
 														  m_font{&_font},
-														  m_data{txt.begin(), txt.end()}
+														  m_data{txt.begin(), txt.end()},
+														  m_vertex_count{},
+														  m_dirty{true}
 	{
 	}
 
 	template <typename CharT = char>
-	void set_string(const std::basic_string<CharT> &txt) { m_data.assign(txt.begin(), txt.end()); }
+	void set_string(const std::basic_string<CharT> &txt)
+	{
+		m_data.assign(txt.begin(), txt.end());
+		m_dirty = true;
+	}
 
 	const std::basic_string<uint32_t> &get_string() const { return m_data; }
 
-	void set_text_origin(glm::vec2 origin) { m_origin = origin; }
+	void set_text_origin(glm::vec2 origin)
+	{
+		m_origin = origin;
+		m_dirty = true;
+	}
 	glm::vec2 get_text_origin() const { return m_origin; }
 
-	void set_text_scale(glm::vec2 scale) { m_scale = scale; }
+	void set_text_scale(glm::vec2 scale)
+	{
+		m_scale = scale;
+		m_dirty = true;
+	}
 	glm::vec2 get_text_scale() const { return m_scale; }
 
-	void set_font(font& _font) { m_font = &_font; }
+	void set_font(font& _font)
+	{
+		m_font = &_font;
+		m_dirty = true;
+	}
 	font const* get_font() const { return m_font;  }
 
 	rect get_local_rect() const;
 
+	// the whole string is one draw call, the vertices are only rebuilt after it's changed
 	void draw(gl_instance &gl) const;
 
 private:
+	void rebuild() const;
+
 	std::basic_string<uint32_t> m_data;
 	glm::vec2 m_origin;
 	glm::vec2 m_scale;
 	font* m_font;
+
+	// two triangles per glyph of position and atlas texel
+	vao m_buff;
+	vbo m_vertices;
+	mutable GLsizei m_vertex_count;
+	mutable bool m_dirty;
 };
 #endif
\ No newline at end of file
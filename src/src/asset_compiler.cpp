@@ -0,0 +1,295 @@
+#include <png.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// build step turning the files in assets/ into sources that get compiled into the game
+// usage: asset_compiler <input> <output directory> <name>
+// .png files become <name>_width, <name>_height, <name>_channels and <name>_qoi, the image encoded as qoi with its rows flipped to be bottom up for opengl
+// <name>_qoi holds <name>_level_count levels, each half the size of the one before, so smaller copies can be loaded when textures are drawn small
+// anything else is embedded as is as <name>_data
+
+struct image
+{
+	int width;
+	int height;
+	int channels;
+	std::vector<unsigned char> pixels;
+};
+
+// only 8 bit images are used, anything else is converted to 8 bit rgb or rgba
+static image read_png(const std::filesystem::path &path)
+{
+	FILE *file = std::fopen(path.string().c_str(), "rb");
+	if (!file)
+		throw std::runtime_error("Couldn't open " + path.string());
+
+	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+	png_infop info = png ? png_create_info_struct(png) : nullptr;
+	if (!info || setjmp(png_jmpbuf(png)))
+	{
+		png_destroy_read_struct(&png, &info, nullptr);
+		std::fclose(file);
+		throw std::runtime_error("Couldn't read " + path.string());
+	}
+
+	png_init_io(png, file);
+	png_read_info(png, info);
+
+	png_set_expand(png);
+	png_set_strip_16(png);
+	png_set_gray_to_rgb(png);
+	png_set_interlace_handling(png);
+	png_read_update_info(png, info);
+
+	image res;
+	res.width = static_cast<int>(png_get_image_width(png, info));
+	res.height = static_cast<int>(png_get_image_height(png, info));
+	res.channels = png_get_channels(png, info);
+	res.pixels.resize(static_cast<std::size_t>(res.width) * res.height * res.channels);
+
+	// flipped so the first row is the bottom of the image
+	std::vector<png_bytep> rows(res.height);
+	for (int y = 0; y < res.height; ++y)
+		rows[y] = res.pixels.data() + static_cast<std::size_t>(res.height - y - 1) * res.width * res.channels;
+
+	png_read_image(png, rows.data());
+	png_destroy_read_struct(&png, &info, nullptr);
+	std::fclose(file);
+
+	return res;
+}
+
+// levels stop before either side would be smaller than this
+static constexpr int min_level_size = 16;
+
+// halves both sides, averaging each 2x2 block weighted by alpha so transparent pixels don't darken the edges
+static image half_size(const image &img)
+{
+	image res;
+	res.width = std::max(1, img.width / 2);
+	res.height = std::max(1, img.height / 2);
+	res.channels = img.channels;
+	res.pixels.resize(static_cast<std::size_t>(res.width) * res.height * res.channels);
+
+	for (int y = 0; y < res.height; ++y)
+	{
+		for (int x = 0; x < res.width; ++x)
+		{
+			double sum[4]{};
+			double weight = 0;
+			for (int sy = 2 * y; sy < std::min(2 * y + 2, img.height); ++sy)
+			{
+				for (int sx = 2 * x; sx < std::min(2 * x + 2, img.width); ++sx)
+				{
+					const unsigned char *in = img.pixels.data() + (static_cast<std::size_t>(sy) * img.width + sx) * img.channels;
+					double a = img.channels == 4 ? in[3] : 255;
+					for (int c = 0; c < 3; ++c)
+						sum[c] += in[c] * a;
+					sum[3] += a;
+					weight += 1;
+				}
+			}
+
+			unsigned char *out = res.pixels.data() + (static_cast<std::size_t>(y) * res.width + x) * res.channels;
+			for (int c = 0; c < 3; ++c)
+				out[c] = static_cast<unsigned char>(sum[3] > 0 ? sum[c] / sum[3] + .5 : 0);
+			if (res.channels == 4)
+				out[3] = static_cast<unsigned char>(sum[3] / weight + .5);
+		}
+	}
+
+	return res;
+}
+
+static void write_u32(std::vector<unsigned char> &out, unsigned v)
+{
+	out.push_back(static_cast<unsigned char>(v >> 24));
+	out.push_back(static_cast<unsigned char>(v >> 16));
+	out.push_back(static_cast<unsigned char>(v >> 8));
+	out.push_back(static_cast<unsigned char>(v));
+}
+
+// see qoi.cpp for the decoder
+static std::vector<unsigned char> qoi_encode(const image &img)
+{
+	std::vector<unsigned char> out{'q', 'o', 'i', 'f'};
+	write_u32(out, img.width);
+	write_u32(out, img.height);
+	out.push_back(static_cast<unsigned char>(img.channels));
+	out.push_back(0); // srgb with linear alpha
+
+	unsigned char index[64][4]{};
+	unsigned char prev[4]{0, 0, 0, 255};
+	unsigned char px[4]{0, 0, 0, 255};
+	int run = 0;
+
+	std::size_t pixel_count = static_cast<std::size_t>(img.width) * img.height;
+	for (std::size_t i = 0; i < pixel_count; ++i)
+	{
+		const unsigned char *in = img.pixels.data() + i * img.channels;
+		for (int c = 0; c < img.channels; ++c)
+			px[c] = in[c];
+
+		bool same = px[0] == prev[0] && px[1] == prev[1] && px[2] == prev[2] && px[3] == prev[3];
+		if (same)
+		{
+			++run;
+			if (run == 62 || i == pixel_count - 1)
+			{
+				out.push_back(static_cast<unsigned char>(0xc0 | (run - 1)));
+				run = 0;
+			}
+			continue;
+		}
+
+		if (run > 0)
+		{
+			out.push_back(static_cast<unsigned char>(0xc0 | (run - 1)));
+			run = 0;
+		}
+
+		int hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+		unsigned char *slot = index[hash];
+		if (slot[0] == px[0] && slot[1] == px[1] && slot[2] == px[2] && slot[3] == px[3])
+			out.push_back(static_cast<unsigned char>(hash));
+		else
+		{
+			for (int c = 0; c < 4; ++c)
+				slot[c] = px[c];
+
+			if (px[3] == prev[3])
+			{
+				signed char vr = static_cast<signed char>(px[0] - prev[0]);
+				signed char vg = static_cast<signed char>(px[1] - prev[1]);
+				signed char vb = static_cast<signed char>(px[2] - prev[2]);
+				signed char vg_r = static_cast<signed char>(vr - vg);
+				signed char vg_b = static_cast<signed char>(vb - vg);
+
+				if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+					out.push_back(static_cast<unsigned char>(0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+				else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8)
+				{
+					out.push_back(static_cast<unsigned char>(0x80 | (vg + 32)));
+					out.push_back(static_cast<unsigned char>((vg_r + 8) << 4 | (vg_b + 8)));
+				}
+				else
+					out.insert(out.end(), {0xfe, px[0], px[1], px[2]});
+			}
+			else
+				out.insert(out.end(), {0xff, px[0], px[1], px[2], px[3]});
+		}
+
+		for (int c = 0; c < 4; ++c)
+			prev[c] = px[c];
+	}
+
+	out.insert(out.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+	return out;
+}
+
+static std::vector<unsigned char> read_file(const std::filesystem::path &path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		throw std::runtime_error("Couldn't open " + path.string());
+	return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+static void write_array(std::ostream &out, const std::string &name, const std::vector<unsigned char> &data, bool internal = false)
+{
+	static constexpr char digits[] = "0123456789ABCDEF";
+
+	if (internal)
+		out << "static ";
+	else
+		out << "extern const unsigned char " << name << "[" << data.size() << "];\n";
+	out << "const unsigned char " << name << "[" << data.size() << "] = {";
+	for (std::size_t i = 0; i < data.size(); ++i)
+	{
+		if (i % 32 == 0)
+			out << "\n";
+		out << "0x" << digits[data[i] >> 4] << digits[data[i] & 0xf] << ',';
+	}
+	out << "\n};\n";
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 4)
+	{
+		std::cerr << "usage: asset_compiler <input> <output directory> <name>\n";
+		return EXIT_FAILURE;
+	}
+
+	std::filesystem::path input = argv[1];
+	std::filesystem::path output = argv[2];
+	std::string name = argv[3];
+
+	try
+	{
+		std::filesystem::create_directories(output);
+
+		std::ofstream header(output / (name + ".h"));
+		std::ofstream source(output / (name + ".cpp"));
+		if (!header || !source)
+			throw std::runtime_error("Couldn't write to " + output.string());
+
+		if (input.extension() == ".png")
+		{
+			image img = read_png(input);
+
+			std::vector<std::vector<unsigned char>> levels{qoi_encode(img)};
+			for (image cur = img; cur.width / 2 >= min_level_size && cur.height / 2 >= min_level_size;)
+			{
+				cur = half_size(cur);
+				levels.push_back(qoi_encode(cur));
+			}
+
+			header << "#include <cstddef>\n"
+				   << "constexpr int " << name << "_width = " << img.width << ";\n"
+				   << "constexpr int " << name << "_height = " << img.height << ";\n"
+				   << "constexpr int " << name << "_channels = " << img.channels << ";\n"
+				   << "// qoi encoded, bottom row first, level i is (max(1, width >> i), max(1, height >> i))\n"
+				   << "constexpr int " << name << "_level_count = " << levels.size() << ";\n"
+				   << "extern const unsigned char *const " << name << "_qoi[" << levels.size() << "];\n"
+				   << "extern const std::size_t " << name << "_qoi_size[" << levels.size() << "];\n";
+
+			source << "#include <cstddef>\n";
+			for (std::size_t i = 0; i < levels.size(); ++i)
+				write_array(source, name + "_qoi_" + std::to_string(i), levels[i], true);
+
+			source << "extern const unsigned char *const " << name << "_qoi[" << levels.size() << "];\n"
+				   << "const unsigned char *const " << name << "_qoi[" << levels.size() << "] = {";
+			for (std::size_t i = 0; i < levels.size(); ++i)
+				source << name << "_qoi_" << i << ", ";
+			source << "};\n";
+
+			source << "extern const std::size_t " << name << "_qoi_size[" << levels.size() << "];\n"
+				   << "const std::size_t " << name << "_qoi_size[" << levels.size() << "] = {";
+			for (const auto &level : levels)
+				source << level.size() << ", ";
+			source << "};\n";
+		}
+		else
+		{
+			std::vector<unsigned char> data = read_file(input);
+			header << "extern const unsigned char " << name << "_data[" << data.size() << "];\n";
+			write_array(source, name + "_data", data);
+		}
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << e.what() << '\n';
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+#include "autosave.h"
+#include "mapped_file.h"
+
+bool autosave::save(std::shared_ptr<const level> snapshot, std::filesystem::path filename)
+{
+	std::lock_guard lock(m_mutex);
+	if (m_status.saving)
+	{
+		++m_status.skipped;
+		return false;
+	}
+	m_status.saving = true;
+
+	// the last save already set saving to false, replacing its future only waits for it to return
+	m_pending = std::async(std::launch::async, [this, snapshot = std::move(snapshot), filename = std::move(filename)]()
+	{
+		auto start = std::chrono::steady_clock::now();
+		std::string error;
+		try
+		{
+			write_file(filename, snapshot->encode());
+		}
+		catch (const std::exception &e)
+		{
+			error = e.what();
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		{
+			std::lock_guard lock(m_mutex);
+			m_status.saving = false;
+			m_status.latency = end - start;
+			m_status.finished = end;
+			m_status.error = std::move(error);
+			if (m_status.error.empty())
+				++m_status.saved;
+		}
+
+		if (m_done)
+			m_done();
+	});
+	return true;
+}
+
+void autosave::wait()
+{
+	if (m_pending.valid())
+		m_pending.wait();
+}
+
+autosave::status autosave::get_status() const
+{
+	std::lock_guard lock(m_mutex);
+	return m_status;
+}
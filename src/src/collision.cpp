@@ -1,9 +1,14 @@
 #include "collision.h"
-		
 
-bool project_onto(const polygon_view &a, const polygon_view &b, float &min_intersection, collision &res)
+#include <algorithm>
+#include <limits>
+#include <iterator>
+
+// works with polygon_view and baked_polygon
+template <typename PolyA, typename PolyB>
+bool project_onto(const PolyA &a, const PolyB &b, float &min_intersection, collision &res)
 {
-	for (std::size_t a_edge = 0; a_edge < a.poly->size(); ++a_edge)
+	for (std::size_t a_edge = 0; a_edge < a.size(); ++a_edge)
 	{
 		glm::vec2 normal = a.normal(a_edge);
 
@@ -46,8 +51,8 @@ bool project_onto(const polygon_view &a, const polygon_view &b, float &min_inter
 	return true;
 }
 
-// returns collision with mtv to get a out of b or false if no collision
-collision collides(const polygon_view &a, const polygon_view &b)
+template <typename PolyA, typename PolyB>
+collision sat(const PolyA &a, const PolyB &b)
 {
 	collision res;
 	res.collides = true;
@@ -66,4 +71,279 @@ collision collides(const polygon_view &a, const polygon_view &b)
 		}
 	}
 	return {};
-}
\ No newline at end of file
+}
+
+// general separating axis test
+collision collides_sat(const polygon_view &a, const polygon_view &b)
+{
+	return sat(a, b);
+}
+
+// rotates v counter clockwise by turns quarter turns without any trig
+static glm::vec2 rotate_quarter(glm::vec2 v, int turns)
+{
+	switch (turns)
+	{
+	case 1:
+		return {-v.y, v.x};
+	case 2:
+		return {-v.x, -v.y};
+	case 3:
+		return {v.y, -v.x};
+	default:
+		return v;
+	}
+}
+
+// points the normal from b to a, same as the end of collides_sat
+static collision finish(glm::vec2 normal, float intersection, glm::vec2 center_diff)
+{
+	collision res;
+	res.collides = true;
+	res.normal = normal;
+	res.mtv = normal * intersection;
+	if (glm::dot(res.normal, center_diff) > 0)
+	{
+		res.mtv *= -1;
+		res.normal *= -1;
+	}
+	return res;
+}
+
+// a is a unit square rotated by a_turns
+// finds the minimum intersection over a's edge normals given the bounds of b on the x and y axis
+// returns false if they are separated
+static bool box_axes(const polygon_view &a, int a_turns, glm::vec2 b_min, glm::vec2 b_max, float &min_intersection, glm::vec2 &normal)
+{
+	glm::vec2 half = a.scale / 2.f;
+	if (a_turns % 2)
+		std::swap(half.x, half.y);
+
+	glm::vec2 a_min = a.offset - half;
+	glm::vec2 a_max = a.offset + half;
+
+	if (a_max.x < b_min.x || b_max.x < a_min.x || a_max.y < b_min.y || b_max.y < a_min.y)
+		return false;
+
+	float x_intersection = std::min(a_max.x - b_min.x, b_max.x - a_min.x);
+	float y_intersection = std::min(a_max.y - b_min.y, b_max.y - a_min.y);
+
+	// the general test takes the first of a's edges with the smallest intersection, so ties go to a's first edge
+	glm::vec2 first = rotate_quarter({0, 1}, a_turns);
+	glm::vec2 second = rotate_quarter({-1, 0}, a_turns);
+	float first_intersection = first.x == 0 ? y_intersection : x_intersection;
+	float second_intersection = first.x == 0 ? x_intersection : y_intersection;
+
+	if (first_intersection <= second_intersection)
+	{
+		min_intersection = first_intersection;
+		normal = first;
+	}
+	else
+	{
+		min_intersection = second_intersection;
+		normal = second;
+	}
+
+	return true;
+}
+
+// a and b are unit squares rotated by a multiple of pi / 2
+static collision collides_boxes(const polygon_view &a, int a_turns, const polygon_view &b, int b_turns)
+{
+	glm::vec2 half = b.scale / 2.f;
+	if (b_turns % 2)
+		std::swap(half.x, half.y);
+
+	float intersection;
+	glm::vec2 normal;
+	if (!box_axes(a, a_turns, b.offset - half, b.offset + half, intersection, normal))
+		return {};
+
+	// b's edge normals are the same axes as a's, so they can't separate them or have a smaller intersection
+	return finish(normal, intersection, b.offset - a.offset);
+}
+
+static void bounds(const glm::vec2 *pts, std::size_t size, glm::vec2 &min, glm::vec2 &max)
+{
+	min = pts[0];
+	max = pts[0];
+	for (std::size_t i = 1; i < size; ++i)
+	{
+		min = {std::min(min.x, pts[i].x), std::min(min.y, pts[i].y)};
+		max = {std::max(max.x, pts[i].x), std::max(max.y, pts[i].y)};
+	}
+}
+
+// a is a unit square rotated by a multiple of pi / 2, b is a polygon in world space
+// normals may be null, in which case they're computed from the points
+static collision collides_box_polygon(const polygon_view &a, int a_turns, const glm::vec2 *pts, const glm::vec2 *normals, std::size_t size, glm::vec2 b_min, glm::vec2 b_max, glm::vec2 b_center)
+{
+	float min_intersection;
+	glm::vec2 min_normal;
+	if (!box_axes(a, a_turns, b_min, b_max, min_intersection, min_normal))
+		return {};
+
+	glm::vec2 half = a.scale / 2.f;
+	if (a_turns % 2)
+		std::swap(half.x, half.y);
+
+	for (std::size_t edge = 0; edge < size; ++edge)
+	{
+		glm::vec2 normal;
+		if (normals)
+			normal = normals[edge];
+		else
+		{
+			glm::vec2 first = pts[edge];
+			glm::vec2 second = pts[(edge + 1) % size];
+			normal = {first.y - second.y, second.x - first.x};
+		}
+
+		// axis aligned edges were already covered by a's edges
+		if (normal.x == 0 || normal.y == 0)
+			continue;
+
+		if (!normals)
+			normal = glm::normalize(normal);
+
+		float a_center = glm::dot(normal, a.offset);
+		float a_radius = half.x * std::abs(normal.x) + half.y * std::abs(normal.y);
+		float amin = a_center - a_radius;
+		float amax = a_center + a_radius;
+
+		float bmin = std::numeric_limits<float>::infinity();
+		float bmax = -std::numeric_limits<float>::infinity();
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			float cur = glm::dot(normal, pts[i]);
+			if (cur < bmin)
+				bmin = cur;
+			if (cur > bmax)
+				bmax = cur;
+		}
+
+		if (amax < bmin || bmax < amin)
+			return {};
+
+		float cur_intersection = std::min(amax - bmin, bmax - amin);
+		if (cur_intersection < min_intersection)
+		{
+			min_intersection = cur_intersection;
+			min_normal = normal;
+		}
+	}
+
+	return finish(min_normal, min_intersection, b_center - a.offset);
+}
+
+// a is a unit square rotated by a multiple of pi / 2, b is any polygon rotated by a multiple of pi / 2
+static collision collides_box_polygon(const polygon_view &a, int a_turns, const polygon_view &b, int b_turns)
+{
+	static constexpr std::size_t max_points = 8;
+
+	std::size_t size = b.size();
+	if (size > max_points)
+		return collides_sat(a, b);
+
+	glm::vec2 pts[max_points];
+	for (std::size_t i = 0; i < size; ++i)
+		pts[i] = b.offset + rotate_quarter(b.scale * b.poly->point(i), b_turns);
+
+	glm::vec2 b_min, b_max;
+	bounds(pts, size, b_min, b_max);
+
+	glm::vec2 b_center = b.offset + rotate_quarter(b.scale * b.poly->center(), b_turns);
+	return collides_box_polygon(a, a_turns, pts, nullptr, size, b_min, b_max, b_center);
+}
+
+// returns collision with mtv to get a out of b or false if no collision
+collision collides(const polygon_view &a, const polygon_view &b)
+{
+	// the player and blocks are all grid aligned, so this avoids the trig in polygon_view::transform
+	if (a.poly->is_unit_square())
+	{
+		int a_turns = a.quarter_turns();
+		int b_turns = b.quarter_turns();
+		if (a_turns >= 0 && b_turns >= 0)
+		{
+			if (b.poly->is_unit_square())
+				return collides_boxes(a, a_turns, b, b_turns);
+			return collides_box_polygon(a, a_turns, b, b_turns);
+		}
+	}
+
+	return collides_sat(a, b);
+}
+
+collision collides(const polygon_view &a, const baked_polygon &b)
+{
+	if (b.size() && a.poly->is_unit_square())
+	{
+		if (int a_turns = a.quarter_turns(); a_turns >= 0)
+		{
+			if (b.is_box())
+			{
+				float intersection;
+				glm::vec2 normal;
+				if (!box_axes(a, a_turns, b.min(), b.max(), intersection, normal))
+					return {};
+				return finish(normal, intersection, b.center() - a.offset);
+			}
+
+			return collides_box_polygon(a, a_turns, b.points(), b.normals(), b.size(), b.min(), b.max(), b.center());
+		}
+	}
+
+	return sat(a, b);
+}
+
+baked_polygon::baked_polygon(const polygon_view &view) : baked_polygon()
+{
+	std::size_t size = view.size();
+	if (!size)
+		return;
+
+	// quarter turns are done exactly so grid aligned edges stay exactly axis aligned
+	int turns = view.quarter_turns();
+	auto transform = [&](glm::vec2 pt)
+	{
+		if (turns >= 0)
+			return view.offset + rotate_quarter(view.scale * pt, turns);
+		return view.transform(pt);
+	};
+
+	m_pts.reserve(size);
+	for (std::size_t i = 0; i < size; ++i)
+		m_pts.push_back(transform(view.poly->point(i)));
+	m_center = transform(view.poly->center());
+
+	m_box = true;
+	m_normals.reserve(size);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		glm::vec2 first = m_pts[i];
+		glm::vec2 second = m_pts[(i + 1) % size];
+		glm::vec2 perp{first.y - second.y, second.x - first.x};
+		m_normals.push_back(glm::normalize(perp));
+
+		if (perp.x != 0 && perp.y != 0)
+			m_box = false;
+	}
+
+	bounds(m_pts.data(), size, m_min, m_max);
+}
+
+const polygon &square()
+{
+	static const glm::vec2 pts[] = {{-.5f, -.5f}, {.5f, -.5f}, {.5f, .5f}, {-.5f, .5f}};
+	static const polygon res(std::begin(pts), std::end(pts));
+	return res;
+}
+const polygon &triangle()
+{
+	// adjust to make hitbox slightly smaller
+	static const glm::vec2 adjusted_pts[] = {{-.5, -.5f}, {.5, -.5f}, {0, .5f}};
+	static const polygon res(std::begin(adjusted_pts), std::end(adjusted_pts));
+	return res;
+}
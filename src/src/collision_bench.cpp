@@ -0,0 +1,131 @@
+#include "collision.h"
+#include "level.h"
+#include "game.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// times collides (on the block's polygon_view and its baked shape) against the general separating axis test for a player placed all around every block of each level
+// pass a directory of levels or a single level, defaults to "levels"
+
+struct test_case
+{
+	polygon_view player;
+	const block *b;
+};
+
+template <typename F>
+double time_per_test(const std::vector<test_case> &tests, F &&collide, std::size_t &hits)
+{
+	static constexpr int repeats = 50;
+
+	hits = 0;
+	auto begin = std::chrono::steady_clock::now();
+	for (int r = 0; r < repeats; ++r)
+		for (const auto &t : tests)
+			if (collide(t.player, *t.b))
+				++hits;
+	auto duration = std::chrono::steady_clock::now() - begin;
+
+	return std::chrono::duration<double, std::nano>(duration).count() / (static_cast<double>(tests.size()) * repeats);
+}
+
+void bench_level(const std::filesystem::path &path)
+{
+	level l;
+	try
+	{
+		l.read_level(path);
+	}
+	catch (const std::exception &e)
+	{
+		std::cout << path.filename().string() << ": " << e.what() << '\n';
+		return;
+	}
+
+	std::vector<test_case> tests;
+	for (const auto &b : l.blocks)
+	{
+		for (int y = -5; y <= 5; ++y)
+		{
+			for (int x = -5; x <= 5; ++x)
+			{
+				glm::vec2 offset = b.poly.offset + glm::vec2{x, y} * (game::block_size / 5.f);
+				tests.push_back({polygon_view(square(), offset, {game::player_size, game::player_size}, 0), &b});
+			}
+		}
+	}
+
+	if (tests.empty())
+		return;
+
+	// make sure both give the same results before timing them
+	std::size_t mismatches = 0;
+	for (const auto &t : tests)
+	{
+		collision sat = collides_sat(t.player, t.b->poly);
+		for (collision fast : {collides(t.player, t.b->poly), collides(t.player, t.b->shape)})
+			if (fast.collides != sat.collides || glm::length(fast.mtv - sat.mtv) > 1e-3f || glm::length(fast.normal - sat.normal) > 1e-3f)
+				++mismatches;
+	}
+
+	std::size_t hits;
+	double sat_time = time_per_test(tests, [](const polygon_view &p, const block &b) { return collides_sat(p, b.poly); }, hits);
+	double fast_time = time_per_test(tests, [](const polygon_view &p, const block &b) { return collides(p, b.poly); }, hits);
+	double baked_time = time_per_test(tests, [](const polygon_view &p, const block &b) { return collides(p, b.shape); }, hits);
+
+	std::cout << std::fixed << std::setprecision(1)
+			  << path.filename().string() << ": " << l.blocks.size() << " blocks, " << tests.size() << " tests, "
+			  << "sat " << sat_time << " ns, fast " << fast_time << " ns (" << sat_time / fast_time << "x), "
+			  << "baked " << baked_time << " ns (" << sat_time / baked_time << "x), "
+			  << mismatches << " mismatches\n";
+}
+
+// reading two blocks far apart, which used to make the index allocate every cell between them
+void bench_far_apart(int distance)
+{
+	level l;
+	l.start = {1, 1};
+	l.end = {2, 1};
+	l.blue_starts = true;
+	l.blocks.emplace_back(glm::ivec2{0, 0}, block::type::normal, color::neutral, direction::up);
+	l.blocks.emplace_back(glm::ivec2{distance, distance}, block::type::spike, color::red, direction::left);
+	auto data = l.encode();
+
+	auto begin = std::chrono::steady_clock::now();
+	level read;
+	read.read_level(data);
+	auto duration = std::chrono::steady_clock::now() - begin;
+
+	std::cout << std::fixed << std::setprecision(3)
+			  << "two blocks " << distance << " cells apart: read in " << std::chrono::duration<double, std::milli>(duration).count() << " ms, "
+			  << read.index.cell_count() << " cells indexed\n";
+}
+
+int main(int argc, char **argv)
+{
+	std::filesystem::path location = argc > 1 ? argv[1] : "levels";
+
+	bench_far_apart(10000);
+	bench_far_apart(40000);
+
+	if (std::filesystem::is_directory(location))
+	{
+		std::vector<std::filesystem::path> paths;
+		for (const auto &entry : std::filesystem::directory_iterator{location})
+			if (entry.is_regular_file() && entry.path().extension() == ".lvl")
+				paths.push_back(entry.path());
+
+		std::sort(paths.begin(), paths.end());
+		for (const auto &path : paths)
+			bench_level(path);
+	}
+	else
+		bench_level(location);
+
+	return 0;
+}
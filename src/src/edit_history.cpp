@@ -0,0 +1,94 @@
+#include "edit_history.h"
+
+#include <algorithm>
+
+void edit_history::touch(const level_grid &grid, glm::ivec2 cell)
+{
+	if (!level_grid::in_bounds(cell))
+		return;
+
+	int i = cell.y * level_grid::width + cell.x;
+	if (m_touched[i])
+		return;
+
+	m_touched[i] = true;
+	m_pending.push_back({static_cast<std::uint32_t>(i) << level_grid::cell_state_bits | grid.state(cell), 0});
+}
+
+void edit_history::touch_anchors(const anchors &current)
+{
+	if (!m_pending_anchors)
+		m_pending_anchors = current;
+}
+
+const edit_history::anchor_step *edit_history::find_anchor_step(std::size_t step) const
+{
+	auto it = std::lower_bound(m_anchor_steps.begin(), m_anchor_steps.end(), step, [](const anchor_step &a, std::size_t s) { return a.step < s; });
+	return it != m_anchor_steps.end() && it->step == step ? &*it : nullptr;
+}
+
+void edit_history::commit(const level_grid &grid, const anchors &current)
+{
+	// keep only the cells that changed
+	std::size_t changed = 0;
+	for (auto d : m_pending)
+	{
+		d.after = grid.state(location(d.cell()));
+		if (d.after != d.before())
+			m_pending[changed++] = d;
+	}
+	m_pending.resize(changed);
+	m_touched.reset();
+
+	std::optional<anchors> anchors_before;
+	if (m_pending_anchors && *m_pending_anchors != current)
+		anchors_before = m_pending_anchors;
+	m_pending_anchors.reset();
+
+	if (m_pending.empty() && !anchors_before)
+		return;
+
+	// anything undone can't be redone after a new change
+	m_deltas.resize(m_done ? m_step_end[m_done - 1] : 0);
+	m_step_end.resize(m_done);
+	while (!m_anchor_steps.empty() && m_anchor_steps.back().step >= m_done)
+		m_anchor_steps.pop_back();
+
+	m_deltas.insert(m_deltas.end(), m_pending.begin(), m_pending.end());
+	m_step_end.push_back(static_cast<std::uint32_t>(m_deltas.size()));
+	if (anchors_before)
+		m_anchor_steps.push_back({m_done, *anchors_before, current});
+	++m_done;
+
+	m_pending.clear();
+}
+
+bool edit_history::undo(level_grid &grid, anchors &current)
+{
+	commit(grid, current);
+	if (m_done == 0)
+		return false;
+
+	--m_done;
+	std::size_t first = m_done ? m_step_end[m_done - 1] : 0;
+	for (std::size_t i = first; i < m_step_end[m_done]; ++i)
+		grid.set_state(location(m_deltas[i].cell()), m_deltas[i].before());
+	if (auto a = find_anchor_step(m_done))
+		current = a->before;
+	return true;
+}
+
+bool edit_history::redo(level_grid &grid, anchors &current)
+{
+	commit(grid, current);
+	if (m_done == m_step_end.size())
+		return false;
+
+	std::size_t first = m_done ? m_step_end[m_done - 1] : 0;
+	for (std::size_t i = first; i < m_step_end[m_done]; ++i)
+		grid.set_state(location(m_deltas[i].cell()), m_deltas[i].after);
+	if (auto a = find_anchor_step(m_done))
+		current = a->after;
+	++m_done;
+	return true;
+}
@@ -2,33 +2,13 @@
 
 game::player_data::player_data() :
 	poly{square(), {}, {game::player_size, game::player_size}, 0},
-	vel{0, 0}, accel{0, game::gravity}, angle_vel{0}, angle{0},
+	vel{0, 0}, accel{0, game::gravity}, angle_vel{0}, angle{0}, prev_offset{0, 0}, prev_angle{0},
 	on_ground{false}, stopping_left{}, stopping_right{}, x_dir{0},
-	on_wall{0}, do_jump{false},
+	on_wall{0}, do_jump{false}, jump_ticks{0},
 	intangible{true}
 {
 }
 
-// assumes ortho has been set and text has been set
-void game::draw(const gl_instance &gl) const
-{
-	const auto &assets = gl.get_assets();
-	const auto &program = gl.get_texture_program();
-	const auto &_shapes = gl.get_shapes();
-
-	print_background(gl);
-
-	levels[cur_level].draw(is_blue ? color::blue : color::red, gl);
-
-	auto m = model(player.poly.offset, player.poly.scale, player.angle);
-	glUniformMatrix4fv(glGetUniformLocation(program.id, "model"), 1, GL_FALSE, &m[0][0]);
-
-	glBindTexture(GL_TEXTURE_2D, assets.player_text.id);
-
-	glBindVertexArray(_shapes.square_vao().id);
-	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
-}
-
 #ifdef MAPJUMP_DEBUG
 #include <iostream>
 #endif
@@ -47,6 +27,9 @@ bool same_dir(const glm::vec2 &a, const glm::vec2 &b)
 
 void game::update(float dt)
 {
+	player.prev_offset = player.poly.offset;
+	player.prev_angle = player.angle;
+
 	static constexpr float air_accel_divisor = 3;
 	float stopping_accel = 1800;
 	float starting_accel = 600;
@@ -140,13 +123,21 @@ void game::update(float dt)
 	// flag set if the player only collided with neutral blocks
 	bool clear_intangible = true;
 
+	const auto &l = *cur;
+
+	// only blocks in the cells around the player can be collided with
+	// padded by a block so blocks the player is pushed into while resolving are included
+	nearby_blocks.clear();
+	l.index.query(player.poly.offset - player.poly.scale / 2.f - (float)block_size, player.poly.offset + player.poly.scale / 2.f + (float)block_size, nearby_blocks);
+
 	// initial pass to resolve collisions
-	for (const auto &b : levels[cur_level].blocks)
+	for (auto i : nearby_blocks)
 	{
+		const auto &b = l.blocks[i];
 		if (!is_on(b.block_color))
 			continue;
 		
-		if (collision c = collides(player.poly, b.poly))
+		if (collision c = collides(player.poly, b.shape))
 		{
 			// if it's collided with a colored block, then don't make tangible
 			if (b.block_color != color::neutral)
@@ -174,25 +165,11 @@ void game::update(float dt)
 
 	glm::vec2 player_min = player.poly.offset - player.poly.scale / 2.f;
 	glm::vec2 player_max = player.poly.offset + player.poly.scale / 2.f;
-	for (const auto [b, c] : collisions)
+	for (const auto &[b, c] : collisions)
 	{
 		bool is_spike = b->block_type == block::type::spike;
-		glm::vec2 block_min, block_max;
-		if (is_spike)
-		{
-			block_min = b->poly.transform({-.5, -.5});
-			block_max = b->poly.transform({.5, .5});
-
-			if (block_min.x > block_max.x)
-				std::swap(block_min.x, block_max.x);
-			if (block_min.y > block_max.y)
-				std::swap(block_min.y, block_max.y);
-		}
-		else
-		{
-			block_min = b->poly.offset - b->poly.scale / 2.f;
-			block_max = b->poly.offset + b->poly.scale / 2.f;
-		}
+		glm::vec2 block_min = b->shape.min();
+		glm::vec2 block_max = b->shape.max();
 
 		// touching horizontally (if player right is > block left and block right is > player lefts)
 		bool touching_horizontally = player_max.x - block_min.x > epsilon && block_max.x - player_min.x > epsilon;
@@ -205,7 +182,7 @@ void game::update(float dt)
 			{
 				direction d = b->dir();
 				// if it's not touching the flat side of the spike
-				if ((d == direction::up || d == direction::down) && !same_dir(-c.normal, b->poly.normal(0)))
+				if ((d == direction::up || d == direction::down) && !same_dir(-c.normal, b->shape.normal(0)))
 				{
 					reset_level();
 					return;
@@ -229,7 +206,7 @@ void game::update(float dt)
 			{
 				direction d = b->dir();
 				// if it's not touching the flat side of the spike
-				if ((d == direction::left || d == direction::right) && !same_dir(-c.normal, b->poly.normal(0)))
+				if ((d == direction::left || d == direction::right) && !same_dir(-c.normal, b->shape.normal(0)))
 				{
 					reset_level();
 					return;
@@ -273,7 +250,7 @@ void game::update(float dt)
 	static constexpr float wall_jump_velocity = 300;
 	static constexpr float jump_angular_velocity = 2 * glm::pi<float>();
 
-	if (player.do_jump && (std::chrono::high_resolution_clock::now() - player.jump_start) < std::chrono::milliseconds(300))
+	if (player.do_jump && player.jump_ticks < jump_buffer_ticks)
 	{
 		if (player.on_ground || player.on_wall)
 		{
@@ -300,8 +277,13 @@ void game::update(float dt)
 		}
 	}
 
-	if (glm::ivec2(player.poly.offset / (float)game::block_size) == levels[cur_level].end)
+	// still waiting to land, the request expires after jump_buffer_ticks
+	if (player.do_jump)
+		++player.jump_ticks;
+
+	if (glm::ivec2(player.poly.offset / (float)game::block_size) == l.end)
 	{
+		// stays on this level if it's the last one that can be read
 		if (cur_level != levels.size() - 1)
 			load_level(cur_level + 1);
 	}
@@ -310,24 +292,49 @@ void game::update(float dt)
 void game::switch_colors()
 {
 	is_blue = !is_blue;
+	const auto &l = *cur;
+
+	nearby_blocks.clear();
+	l.index.query(player.poly.offset - player.poly.scale / 2.f, player.poly.offset + player.poly.scale / 2.f, nearby_blocks);
+
 	// pass to check for player stuck in block
-	for (const auto &b : levels[cur_level].blocks)
-		if (is_blue == (b.block_color == color::blue) && collides(player.poly, b.poly))
+	for (auto i : nearby_blocks)
+	{
+		const auto &b = l.blocks[i];
+		if (is_blue == (b.block_color == color::blue) && collides(player.poly, b.shape))
 			player.intangible = true;
+	}
 }
 
-void game::load_level(std::size_t level)
+bool game::load_level(std::size_t level)
 {
-	auto &l = levels[level];
+	std::shared_ptr<const ::level> next;
+	while (level < levels.size() && !(next = levels[level].get()))
+		++level;
+	if (!next)
+		return false;
+
+	cur = std::move(next);
 	cur_level = level;
+	const auto &l = *cur;
+
+	// read while this level is played so moving on doesn't stall
+	if (level + 1 < levels.size())
+		levels[level + 1].prefetch();
+
 	player.poly.offset = (glm::vec2(l.start) + glm::vec2(.5, .5)) * glm::vec2(block_size, block_size);
 	is_blue = l.blue_starts;
 	collisions.reserve(l.blocks.size());
+
+	// don't interpolate from the previous level
+	player.prev_offset = player.poly.offset;
+	player.prev_angle = player.angle;
+	return true;
 }
 
 void game::reset_level()
 {
-	auto &l = levels[cur_level];
+	const auto &l = *cur;
 	player.vel = {0, 0};
 	player.accel.x = 0;
 	player.do_jump = false;
@@ -338,4 +345,7 @@ void game::reset_level()
 	player.x_dir = 0;
 	player.poly.offset = (glm::vec2(l.start) + glm::vec2(.5, .5)) * glm::vec2(block_size, block_size);
 	player.angle = 0;
+
+	player.prev_offset = player.poly.offset;
+	player.prev_angle = player.angle;
 }
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include "game_assets.h"
+#include "gl_instance.h"
+#include "game.h"
+#include "qoi.h"
+
+#include "background.h"
+#include "blue_cube.h"
+#include "blue_cube_fade.h"
+#include "blue_jump.h"
+#include "blue_spike.h"
+#include "blue_spike_fade.h"
+#include "end_anchor.h"
+#include "neutral_cube.h"
+#include "neutral_jump.h"
+#include "neutral_spike.h"
+#include "player_text.h"
+#include "red_cube.h"
+#include "red_cube_fade.h"
+#include "red_jump.h"
+#include "red_spike.h"
+#include "red_spike_fade.h"
+#include "spawn_anchor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <exception>
+
+struct image_source
+{
+	const unsigned char *const *levels;
+	const std::size_t *sizes;
+	int level_count;
+	int width;
+	int height;
+	GLenum target_format;
+};
+
+template <std::size_t N>
+static constexpr image_source source(const unsigned char *const (&levels)[N], const std::size_t (&sizes)[N], int width, int height, GLenum target_format)
+{
+	return {levels, sizes, static_cast<int>(N), width, height, target_format};
+}
+
+// the block layers in layer order, then the background and player
+static const image_source sources[] = {
+	source(blue_cube_qoi, blue_cube_qoi_size, blue_cube_width, blue_cube_height, GL_RGBA),
+	source(blue_cube_fade_qoi, blue_cube_fade_qoi_size, blue_cube_fade_width, blue_cube_fade_height, GL_RGBA),
+	source(blue_jump_qoi, blue_jump_qoi_size, blue_jump_width, blue_jump_height, GL_RGBA),
+	source(blue_spike_qoi, blue_spike_qoi_size, blue_spike_width, blue_spike_height, GL_RGBA),
+	source(blue_spike_fade_qoi, blue_spike_fade_qoi_size, blue_spike_fade_width, blue_spike_fade_height, GL_RGBA),
+	source(end_anchor_qoi, end_anchor_qoi_size, end_anchor_width, end_anchor_height, GL_RGB),
+	source(neutral_cube_qoi, neutral_cube_qoi_size, neutral_cube_width, neutral_cube_height, GL_RGBA),
+	source(neutral_jump_qoi, neutral_jump_qoi_size, neutral_jump_width, neutral_jump_height, GL_RGBA),
+	source(neutral_spike_qoi, neutral_spike_qoi_size, neutral_spike_width, neutral_spike_height, GL_RGBA),
+	source(red_cube_qoi, red_cube_qoi_size, red_cube_width, red_cube_height, GL_RGB),
+	source(red_cube_fade_qoi, red_cube_fade_qoi_size, red_cube_fade_width, red_cube_fade_height, GL_RGBA),
+	source(red_jump_qoi, red_jump_qoi_size, red_jump_width, red_jump_height, GL_RGBA),
+	source(red_spike_qoi, red_spike_qoi_size, red_spike_width, red_spike_height, GL_RGBA),
+	source(red_spike_fade_qoi, red_spike_fade_qoi_size, red_spike_fade_width, red_spike_fade_height, GL_RGBA),
+	source(spawn_anchor_qoi, spawn_anchor_qoi_size, spawn_anchor_width, spawn_anchor_height, GL_RGBA),
+	source(background_qoi, background_qoi_size, background_width, background_height, GL_RGBA),
+	source(player_text_qoi, player_text_qoi_size, player_text_width, player_text_height, GL_RGBA),
+};
+
+static constexpr std::size_t image_count = std::size(sources);
+static constexpr std::size_t background_image = game_assets::layer_count;
+static constexpr std::size_t player_text_image = game_assets::layer_count + 1;
+
+static_assert(image_count == game_assets::layer_count + 2, "every layer needs an image");
+
+// layers are never smaller than this or bigger than the biggest block texture
+static constexpr GLsizei min_layer_size = 16;
+static constexpr GLsizei max_layer_size = 512;
+
+// same as the asset compiler
+static glm::ivec2 level_size(const image_source &src, int level)
+{
+	return {std::max(1, src.width >> level), std::max(1, src.height >> level)};
+}
+
+// smallest level at least width pixels wide, or the full image if it's smaller than that
+static int pick_level(const image_source &src, int width)
+{
+	int level = 0;
+	while (level + 1 < src.level_count && level_size(src, level + 1).x >= width)
+		++level;
+	return level;
+}
+
+game_assets::loader::loader(float scale) : m_scale{scale}, m_layer_size{min_layer_size}, m_promises(image_count), m_next{0}
+{
+	// blocks are block_size pixels at a scale of 1, keep layers a power of two like the sources
+	auto block_pixels = static_cast<GLsizei>(std::ceil(game::block_size * scale));
+	while (m_layer_size < block_pixels && m_layer_size < max_layer_size)
+		m_layer_size *= 2;
+
+	for (std::size_t i = 0; i < image_count; ++i)
+	{
+		int width = m_layer_size;
+		if (i == background_image)
+			width = static_cast<int>(std::ceil(target_width * scale));
+		else if (i == player_text_image)
+			width = static_cast<int>(std::ceil(game::player_size * scale));
+
+		int level = pick_level(sources[i], width);
+		m_levels.push_back(level);
+
+		if (i < layer_count)
+			m_bytes.push_back(static_cast<std::size_t>(m_layer_size) * m_layer_size * 4);
+		else
+		{
+			glm::ivec2 size = level_size(sources[i], level);
+			int channels = i == background_image ? background_channels : player_text_channels;
+			m_bytes.push_back(static_cast<std::size_t>(size.x) * size.y * channels);
+		}
+	}
+
+	m_images.reserve(image_count);
+	for (auto &p : m_promises)
+		m_images.push_back(p.get_future());
+
+	auto work = [this]()
+	{
+		for (std::size_t i = m_next++; i < image_count; i = m_next++)
+		{
+			try
+			{
+				const auto &src = sources[i];
+				int level = m_levels[i];
+				qoi_image decoded = qoi_decode(src.levels[level], src.sizes[level]);
+
+				image res;
+				if (i < layer_count)
+				{
+					res.pixels = texture_array::convert(m_layer_size, m_layer_size, src.target_format, decoded.pixels.data(), decoded.width, decoded.height, decoded.channels);
+					res.width = res.height = m_layer_size;
+					res.channels = 4;
+				}
+				else
+				{
+					res.pixels = std::move(decoded.pixels);
+					res.width = decoded.width;
+					res.height = decoded.height;
+					res.channels = decoded.channels;
+				}
+
+				m_promises[i].set_value(std::move(res));
+			}
+			catch (...)
+			{
+				m_promises[i].set_exception(std::current_exception());
+			}
+		}
+	};
+
+	std::size_t worker_count = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, image_count);
+	for (std::size_t i = 0; i < worker_count; ++i)
+		m_workers.emplace_back(work);
+}
+
+game_assets::loader::~loader()
+{
+	for (auto &w : m_workers)
+		w.join();
+}
+
+game_assets::loader::image game_assets::loader::get(std::size_t i)
+{
+	return m_images[i].get();
+}
+
+game_assets::game_assets(loader &images) : m_scale{}
+{
+	load(images);
+}
+
+void game_assets::load(loader &images)
+{
+	if (blocks.width != images.m_layer_size)
+		blocks = texture_array(images.m_layer_size, images.m_layer_size, layer_count);
+
+	// every image's size is known before it's decoded, so the buffer can be laid out up front
+	std::size_t offsets[image_count + 1]{};
+	for (std::size_t i = 0; i < image_count; ++i)
+		offsets[i + 1] = offsets[i] + images.m_bytes[i];
+
+	buffer pixels;
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixels.id);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, offsets[image_count], nullptr, GL_STREAM_DRAW);
+
+	// ranges don't overlap, so writing one doesn't need to wait for the uploads from the others
+	for (std::size_t i = 0; i < image_count; ++i)
+	{
+		loader::image img = images.get(i);
+		std::size_t size = std::min(img.pixels.size(), images.m_bytes[i]);
+
+		if (void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offsets[i], images.m_bytes[i], GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT))
+		{
+			std::memcpy(dst, img.pixels.data(), size);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		}
+
+		const void *offset = reinterpret_cast<const void *>(offsets[i]);
+		if (i < layer_count)
+			blocks.upload_layer(static_cast<GLsizei>(i), offset);
+		else if (i == background_image)
+			background = texture(sources[i].target_format, offset, img.width, img.height, img.channels);
+		else
+			player_text = texture(sources[i].target_format, offset, img.width, img.height, img.channels);
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	m_scale = images.m_scale;
+}
+
+void game_assets::fit(float scale)
+{
+	if (scale <= m_scale)
+		return;
+
+	loader images(scale);
+	load(images);
+}
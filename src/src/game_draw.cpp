@@ -0,0 +1,31 @@
+#include "game.h"
+#include "gl_instance.h"
+#include "level_cache.h"
+
+// assumes ortho has been set and text has been set
+void game::draw(const gl_instance &gl, const level_cache &cache, float alpha) const
+{
+	const auto &assets = gl.get_assets();
+	const auto &program = gl.get_texture_program();
+	const auto &_shapes = gl.get_shapes();
+
+	cache.draw(is_blue ? color::blue : color::red, gl);
+
+	glUseProgram(program.id);
+	program.set(uniform::transparency, 1.f);
+
+	glm::vec2 offset = player.prev_offset + (player.poly.offset - player.prev_offset) * alpha;
+
+	// the angle wraps every quarter turn, don't interpolate across the wrap
+	float angle = player.angle;
+	if (std::abs(player.angle - player.prev_angle) < glm::pi<float>() / 4)
+		angle = player.prev_angle + (player.angle - player.prev_angle) * alpha;
+
+	auto m = model(offset, player.poly.scale, angle);
+	program.set(uniform::model, m);
+
+	glBindTexture(GL_TEXTURE_2D, assets.player_text.id);
+
+	glBindVertexArray(_shapes.square_vao().id);
+	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+}
@@ -1,4 +1,7 @@
 #include "gl_instance.h"
+#include "arial.h"
+
+#include <algorithm>
 
 static const glm::vec2 square_pts[] = {{-.5f, -.5f}, {.5f, -.5f}, {.5f, .5f}, {-.5f, .5f}};
 static const glm::vec2 triangle_pts[] = {{-.5f, -.5f}, {.5f, -.5f}, {0, .5f}};
@@ -59,6 +62,31 @@ shapes::shapes() : m_buffers{}
 {
 }
 
+static void attach(const vao &v, const vbo &pos, const vbo &text_pos)
+{
+	glBindVertexArray(v.id);
+
+	glBindBuffer(GL_ARRAY_BUFFER, pos.id);
+	glVertexAttribPointer(pos_attribute, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+	glEnableVertexAttribArray(pos_attribute);
+
+	glBindBuffer(GL_ARRAY_BUFFER, text_pos.id);
+	glVertexAttribPointer(text_pos_attribute, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+	glEnableVertexAttribArray(text_pos_attribute);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void shapes::attach_square(const vao &v) const
+{
+	attach(v, m_buffers.square_vbo, m_buffers.square_text_pos_vbo);
+}
+
+void shapes::attach_triangle(const vao &v) const
+{
+	attach(v, m_buffers.triangle_vbo, m_buffers.triangle_text_pos_vbo);
+}
+
 static constexpr const char *texture_vert =
 	"#version 330 core\n" // vertex shader
 	"layout (location = 0) in vec2 pos;"
@@ -82,16 +110,60 @@ static constexpr const char *texture_frag =
 	"	frag_color = vec4(text_col.xyz, text_col.w * transparency);"
 	"}";
 
+static constexpr const char *layer_texture_frag =
+	"#version 330 core\n" // fragment shader
+	"uniform sampler2DArray text;"
+	"uniform float transparency = 1.0;"
+	"uniform int layer;"
+	"in vec2 texture_coord;"
+	"out vec4 frag_color;"
+	"void main(){\n"
+	"	vec4 text_col = texture(text, vec3(texture_coord, layer));"
+	"	frag_color = vec4(text_col.xyz, text_col.w * transparency);"
+	"}";
+
+// basis is the columns of the rotation and scale of each instance
+// layers are the (off, on) layers of the instance, picked by whether its color is active (see color in level.h)
+static constexpr const char *instanced_texture_vert =
+	"#version 330 core\n" // vertex shader
+	"layout (location = 0) in vec2 pos;"
+	"layout (location = 1) in vec2 tex_coord;"
+	"layout (location = 2) in vec4 basis;"
+	"layout (location = 3) in vec2 offset;"
+	"layout (location = 4) in ivec2 layers;"
+	"layout (location = 5) in int block_color;"
+	"uniform mat4 ortho;"
+	"uniform int active_color;"
+	"out vec2 texture_coord;"
+	"flat out int layer;"
+	"void main(){"
+	"	gl_Position = ortho * vec4(mat2(basis.xy, basis.zw) * pos + offset, 0, 1);"
+	"	texture_coord = tex_coord;"
+	"	bool on = active_color == 3 || block_color == active_color || block_color == 2;"
+	"	layer = on ? layers.y : layers.x;"
+	"}";
+
+static constexpr const char *instanced_texture_frag =
+	"#version 330 core\n" // fragment shader
+	"uniform sampler2DArray text;"
+	"uniform float transparency = 1.0;"
+	"in vec2 texture_coord;"
+	"flat in int layer;"
+	"out vec4 frag_color;"
+	"void main(){\n"
+	"	vec4 text_col = texture(text, vec3(texture_coord, layer));"
+	"	frag_color = vec4(text_col.xyz, text_col.w * transparency);"
+	"}";
 
+// positions are already in world space and texture coordinates are texels of the glyph atlas
 static constexpr const char *text_vert =
 	"#version 330 core\n" // vertex shader
 	"layout (location = 0) in vec2 pos;"
 	"layout (location = 1) in vec2 tex_coord;"
 	"uniform mat4 ortho;"
-	"uniform mat4 model;"
 	"out vec2 texture_coord;"
 	"void main() {"
-	"	gl_Position = ortho * model * vec4(pos, 0.0, 1.0);"
+	"	gl_Position = ortho * vec4(pos, 0.0, 1.0);"
 	"	texture_coord = tex_coord;"
 	"}";
 static constexpr const char *text_frag =
@@ -101,7 +173,7 @@ static constexpr const char *text_frag =
 	"in vec2 texture_coord;"
 	"out vec4 frag_color;"
 	"void main() {"
-	"	frag_color = vec4(color.xyz, color.w * texture(text, texture_coord).r);"
+	"	frag_color = vec4(color.xyz, color.w * texture(text, texture_coord / vec2(textureSize(text, 0))).r);"
 	"}";
 
 
@@ -122,16 +194,33 @@ static constexpr const char *shape_frag =
 	"	frag_color = color;"
 	"}";
 
+// the framebuffer of a window on a high dpi screen can be bigger than the window by the content scale
+// loading for the bigger size up front means fit has nothing to reload, where it isn't bigger the images are only a level larger than needed
+static float expected_scale(int height)
+{
+	float xscale = 1, yscale = 1;
+	if (GLFWmonitor *monitor = glfwGetPrimaryMonitor())
+		glfwGetMonitorContentScale(monitor, &xscale, &yscale);
+	return std::max(yscale, 1.f) * height / target_height;
+}
+
 gl_instance::gl_instance(int width, int height, const char *title) :
-	m_glfw(), m_window(width, height, title), m_shapes(),
+	m_glfw(), m_asset_loader(expected_scale(height)), m_window(width, height, title), m_shapes(),
 	m_texture_program(texture_vert, texture_frag), m_text_program(text_vert, text_frag), m_shape_program(shape_vert, shape_frag),
-	m_assets(),
+	m_instanced_texture_program(instanced_texture_vert, instanced_texture_frag), m_layer_texture_program(texture_vert, layer_texture_frag),
+	m_assets(m_asset_loader),
 	m_ortho(glm::ortho<float>(0, (float)target_width, 0, (float)target_height, -1, 1)),
 	m_font(arial_data, sizeof(arial_data), 256),
 	m_min{}, m_size{width, height}
 {
 	glfwSetWindowUserPointer(m_window.handle, this);
 	glfwSetFramebufferSizeCallback(m_window.handle, framebuffer_size_callback);
+	glfwSetWindowRefreshCallback(m_window.handle, window_refresh_callback);
+
+	// only reloads if the framebuffer turned out bigger than expected_scale guessed
+	int framebuffer_width, framebuffer_height;
+	glfwGetFramebufferSize(m_window.handle, &framebuffer_width, &framebuffer_height);
+	m_assets.fit(static_cast<float>(framebuffer_height) / target_height);
 }
 
 void gl_instance::framebuffer_size_callback(GLFWwindow* window, int width, int height)
@@ -164,6 +253,7 @@ void gl_instance::framebuffer_size_callback(GLFWwindow* window, int width, int h
     glViewport(leftover_width / 2, leftover_height / 2, new_width, new_height);
 
 	gl_instance *owner = static_cast<gl_instance *>(glfwGetWindowUserPointer(window));
+	owner->m_assets.fit(static_cast<float>(new_height) / target_height);
 	if (owner->m_draw)
 		owner->m_draw();
 	
@@ -176,11 +266,18 @@ void gl_instance::framebuffer_size_callback(GLFWwindow* window, int width, int h
 	owner->m_size.y = static_cast<int>(new_height / yscale);
 }
 
+void gl_instance::window_refresh_callback(GLFWwindow* window)
+{
+	gl_instance *owner = static_cast<gl_instance *>(glfwGetWindowUserPointer(window));
+	if (owner->m_draw)
+		owner->m_draw();
+}
+
 void print_background(const gl_instance &gl)
 {
 	// print background
 	auto m = glm::scale(glm::translate(glm::mat4(1.f), {target_width / 2.f, target_height / 2.f, 0}), {target_width, target_height, 0});
-	glUniformMatrix4fv(glGetUniformLocation(gl.get_texture_program().id, "model"), 1, GL_FALSE, &m[0][0]);
+	gl.get_texture_program().set(uniform::model, m);
 
 	glBindTexture(GL_TEXTURE_2D, gl.get_assets().background.id);
 
@@ -188,19 +285,6 @@ void print_background(const gl_instance &gl)
 	glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 }
 
-const polygon &square()
-{
-	static const polygon res(std::begin(square_pts), std::end(square_pts));
-	return res;
-}
-const polygon &triangle()
-{
-	// adjust to make hitbox slightly smaller
-	static const glm::vec2 adjusted_pts[] = {{-.5, -.5f}, {.5, -.5f}, {0, .5f}};
-	static const polygon res(std::begin(adjusted_pts), std::end(adjusted_pts));
-	return res;
-}
-
 void mouse_pos_interp(glm::dvec2 window_min, glm::dvec2 window_max, glm::dvec2 target_min, glm::dvec2 target_max, glm::dvec2 &mouse_pos)
 {
 	mouse_pos.x = (target_max.x - target_min.x) / (window_max.x - window_min.x) * (mouse_pos.x - window_min.x) + target_min.x;
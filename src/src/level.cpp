@@ -1,12 +1,18 @@
 #include "level.h"
 #include "game.h"
+#include "mapped_file.h"
 
-#include <fstream>
 #include <stdexcept>
-
-#include <regex>
-
-#include <map>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <array>
+#include <bit>
+#include <limits>
+#include <atomic>
+#include <optional>
+#include <string_view>
+#include <thread>
 
 block::block(glm::ivec2 grid_loc, type _block_type, color _block_color, direction dir) : block_type{_block_type}, block_color{_block_color}
 {	
@@ -44,94 +50,7 @@ block::block(glm::ivec2 grid_loc, type _block_type, color _block_color, directio
 	}
 
 	poly.offset = glm::vec2(grid_loc) * (float)game::block_size + poly_trans;
-}
-
-void block::draw(color active_color, const gl_instance &gl, float transparency) const
-{
-	const auto &assets = gl.get_assets();
-
-	bool on = active_color == color::no_color || active_color == block_color || block_color == color::neutral;
-		
-	const texture *text;
-	const vao *buff;
-	switch (block_type)
-	{
-	case block::type::jump:
-		switch (block_color)
-		{
-		case color::blue:
-			if (on)
-				text = &assets.blue_jump;
-			else
-				text = &assets.blue_cube_fade;
-			break;
-		case color::red:
-			if (on)
-				text = &assets.red_jump;
-			else
-				text = &assets.red_cube_fade;
-			break;
-		case color::neutral: // for readability
-		default: // if no_color is somehow here, just do neutral
-			text = &assets.neutral_jump;
-			break;
-		}
-		buff = &gl.get_shapes().square_vao();
-		break;
-	case block::type::spike:
-		switch (block_color)
-		{
-		case color::blue:
-			if (on)
-				text = &assets.blue_spike;
-			else
-				text = &assets.blue_spike_fade;
-			break;
-		case color::red:
-			if (on)
-				text = &assets.red_spike;
-			else
-				text = &assets.red_spike_fade;
-			break;
-		case color::neutral: // for readability
-		default: // if no_color is somehow here, just do neutral
-			text = &assets.neutral_spike;
-			break;
-		}
-		buff = &gl.get_shapes().triangle_vao();
-		break;
-	case block::type::normal:
-		switch (block_color)
-		{
-		case color::blue:
-			if (on)
-				text = &assets.blue_cube;
-			else
-				text = &assets.blue_cube_fade;
-			break;
-		case color::red:
-			if (on)
-				text = &assets.red_cube;
-			else
-				text = &assets.red_cube_fade;
-			break;
-		case color::neutral: // for readability
-		default: // if no_color is somehow here, just do neutral
-			text = &assets.neutral_cube;
-			break;
-		}
-		buff = &gl.get_shapes().square_vao();
-		break;
-	}
-
-	auto m = model(poly.offset, poly.scale, poly.angle);
-	glUniformMatrix4fv(glGetUniformLocation(gl.get_texture_program().id, "model"), 1, GL_FALSE, &m[0][0]);
-	glUniform1f(glGetUniformLocation(gl.get_texture_program().id, "transparency"), transparency);
-
-	glBindTexture(GL_TEXTURE_2D, text->id);
-
-	glBindVertexArray(buff->id);
-	glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(poly.size()));
+	shape = baked_polygon(poly);
 }
 
 direction block::dir() const
@@ -165,199 +84,571 @@ void level::construct_default()
 		blocks.emplace_back(glm::ivec2{0, i}, block::type::normal, color::neutral, direction::up);
 		blocks.emplace_back(glm::ivec2{game::map_width - 1, i}, block::type::normal, color::neutral, direction::up);
 	}
+
+	build_index();
+}
+
+static glm::ivec2 grid_location(glm::vec2 pt)
+{
+	return {static_cast<int>(std::floor(pt.x / game::block_size)), static_cast<int>(std::floor(pt.y / game::block_size))};
 }
 
-void level::draw(color active_color, const gl_instance &gl) const
+void block_grid::build(const std::vector<block> &blocks)
 {
-	for (const auto &b : blocks)
-		b.draw(active_color, gl);
+	m_keys.clear();
+	m_cell_start.clear();
+	m_indices.clear();
+
+	if (blocks.empty())
+		return;
+
+	// every block lies within a single cell, so its center determines its cell
+	// sorting by cell then index keeps the level order within each cell
+	std::vector<std::pair<std::uint64_t, std::uint32_t>> cells;
+	cells.reserve(blocks.size());
+	for (std::uint32_t i = 0; i < blocks.size(); ++i)
+		cells.emplace_back(key(grid_location(blocks[i].poly.offset)), i);
+	std::sort(cells.begin(), cells.end());
+
+	m_indices.reserve(cells.size());
+	for (std::size_t i = 0; i < cells.size(); ++i)
+	{
+		if (i == 0 || cells[i].first != cells[i - 1].first)
+		{
+			m_keys.push_back(cells[i].first);
+			m_cell_start.push_back(static_cast<std::uint32_t>(i));
+		}
+		m_indices.push_back(cells[i].second);
+	}
+	m_cell_start.push_back(static_cast<std::uint32_t>(cells.size()));
+}
+
+void block_grid::query(glm::vec2 min, glm::vec2 max, std::vector<std::uint32_t> &out) const
+{
+	if (m_keys.empty())
+		return;
+
+	// widened slightly so blocks that are only touching the box are still found
+	glm::ivec2 first = grid_location(min - 1.f);
+	glm::ivec2 last = grid_location(max + 1.f);
+
+	auto begin = out.size();
+	auto append = [&](std::size_t i) { out.insert(out.end(), m_indices.begin() + m_cell_start[i], m_indices.begin() + m_cell_start[i + 1]); };
+
+	// a box covering more cells than are occupied is cheaper to answer by checking every occupied cell
+	std::int64_t box_cells = (static_cast<std::int64_t>(last.x) - first.x + 1) * (static_cast<std::int64_t>(last.y) - first.y + 1);
+	if (box_cells > static_cast<std::int64_t>(m_keys.size()))
+	{
+		for (std::size_t i = 0; i < m_keys.size(); ++i)
+		{
+			glm::ivec2 cell{static_cast<std::int32_t>(static_cast<std::uint32_t>(m_keys[i])), static_cast<std::int32_t>(static_cast<std::uint32_t>(m_keys[i] >> 32))};
+			if (cell.x >= first.x && cell.x <= last.x && cell.y >= first.y && cell.y <= last.y)
+				append(i);
+		}
+	}
+	else
+	{
+		for (int y = first.y; y <= last.y; ++y)
+		{
+			for (int x = first.x; x <= last.x; ++x)
+			{
+				auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key({x, y}));
+				if (it != m_keys.end() && *it == key({x, y}))
+					append(it - m_keys.begin());
+			}
+		}
+	}
+
+	// only a handful of blocks, restore level order so collisions resolve in the same order as a full scan
+	std::sort(out.begin() + begin, out.end());
 }
 
 const std::string header_tag = "MapJumpLevelFile";
 
 using vec_type = glm::vec<2, std::int32_t>;
 
+// v1 stores the block count straight after the header tag, later versions store this there followed by a version byte
+// a v1 file would need ~47 GB of blocks to reach it
+static constexpr std::uint32_t versioned_flag = 0xffffffff;
+static constexpr std::uint8_t current_version = 2;
+
+// v1: u32 block count, i32 x2 start, i32 x2 end, bool blue starts, then per block u8 type, u8 color, u8 direction, i32 x2 grid location
+// size of each block in a v1 file: type, color, direction and grid location
+static constexpr std::size_t block_record_size = sizeof(block::type) + sizeof(color) + sizeof(direction) + sizeof(vec_type);
+static constexpr std::size_t v1_header_size = sizeof(std::uint32_t) + 2 * sizeof(vec_type) + sizeof(bool);
+
+// v2 stores the blocks as a grid covering the blocks, start and end, all in one buffer followed by its crc
+// u32 versioned_flag, u8 version, i32 x2 grid origin, u16 x2 grid size
+// u16 x2 start and u16 x2 end relative to the origin, u8 flags (bit 0 is blue starts, bit 1 an order table follows the records), u32 block count
+// occupancy bitmask, one bit per cell in row order starting from the origin, low bit first
+// a byte per block in the same order as the occupied cells, the low nibble is the type and color (color << 2 | type)
+// and the high nibble the direction with bit 2 set when the next block is in the same cell (stacked spikes)
+// when the level order isn't the cell order, the record index of each block in level order, u16 each or u32 if there are more than 65535 blocks
+// collisions resolve in level order, so it has to survive a save
+// u32 crc-32 of everything before it, header tag included
+static constexpr std::size_t v2_header_size = sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(vec_type) + 6 * sizeof(std::uint16_t) + sizeof(std::uint8_t) + sizeof(std::uint32_t);
+static constexpr unsigned same_cell_bit = 1 << 6;
+static constexpr std::uint8_t blue_starts_flag = 1;
+static constexpr std::uint8_t order_table_flag = 1 << 1;
+
+static std::size_t order_entry_size(std::size_t count)
+{
+	return count > std::numeric_limits<std::uint16_t>::max() ? sizeof(std::uint32_t) : sizeof(std::uint16_t);
+}
+static constexpr std::size_t crc_size = sizeof(std::uint32_t);
+
+static std::uint32_t crc32(const unsigned char *data, std::size_t size)
+{
+	static const auto table = []
+	{
+		std::array<std::uint32_t, 256> res;
+		for (std::uint32_t i = 0; i < 256; ++i)
+		{
+			std::uint32_t c = i;
+			for (int k = 0; k < 8; ++k)
+				c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+			res[i] = c;
+		}
+		return res;
+	}();
+
+	std::uint32_t crc = 0xffffffff;
+	for (std::size_t i = 0; i < size; ++i)
+		crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+	return crc ^ 0xffffffff;
+}
+
+static glm::ivec2 block_location(const block &b)
+{
+	return grid_location(b.poly.offset);
+}
+
 void level::read_level(const std::filesystem::path &filename)
+{
+	if (filename.extension() != ".lvl")
+		throw std::runtime_error("Can only read .lvl files");
+
+	mapped_file file(filename);
+	read_level({file.data(), file.size()});
+}
+
+void level::read_level(std::span<const unsigned char> data)
 {
 	blocks.clear();
 	start = {0, 0};
 	end = {0, 0};
 	blue_starts = true;
 
-	if (filename.extension() != ".lvl")
-		throw std::runtime_error("Can only read .lvl files");
+	const unsigned char *pos = data.data();
+	std::size_t remaining = data.size();
 
-	std::ifstream in(filename, std::ios_base::binary);
-	if (!in)
-		throw std::runtime_error("Couldn't open file for reading");
-	
+	// copies the next field out of data, the mapping has no alignment guarantees
+	auto read = [&](auto &field)
 	{
-		std::string header(header_tag.size(), '\0');
-		if (!in.read(header.data(), header.size()) || header != header_tag)
+		if (remaining < sizeof(field))
 			throw std::runtime_error("Invalid file");
-	}
+		std::memcpy(&field, pos, sizeof(field));
+		pos += sizeof(field);
+		remaining -= sizeof(field);
+	};
 
-	std::uint32_t size;
-	if (!in.read(reinterpret_cast<char *>(&size), sizeof(size)))
+	if (remaining < header_tag.size() || std::memcmp(pos, header_tag.data(), header_tag.size()) != 0)
 		throw std::runtime_error("Invalid file");
+	pos += header_tag.size();
+	remaining -= header_tag.size();
+
+	std::uint32_t size;
+	read(size);
+
+	if (size == versioned_flag)
+	{
+		std::uint8_t version;
+		read(version);
+		if (version != current_version || remaining < crc_size)
+			throw std::runtime_error("Invalid file");
+
+		std::uint32_t crc;
+		std::memcpy(&crc, data.data() + data.size() - crc_size, crc_size);
+		if (crc != crc32(data.data(), data.size() - crc_size))
+			throw std::runtime_error("Invalid file");
+		remaining -= crc_size;
+
+		vec_type origin;
+		read(origin);
+
+		std::uint16_t width, height;
+		read(width);
+		read(height);
+
+		std::uint16_t x, y;
+		read(x);
+		read(y);
+		start = origin + vec_type{x, y};
+		read(x);
+		read(y);
+		end = origin + vec_type{x, y};
+
+		std::uint8_t flags;
+		read(flags);
+		if (flags & ~(blue_starts_flag | order_table_flag))
+			throw std::runtime_error("Invalid file");
+		blue_starts = flags & blue_starts_flag;
+		bool has_order = flags & order_table_flag;
+
+		std::uint32_t count;
+		read(count);
+
+		std::size_t cells = static_cast<std::size_t>(width) * height;
+		std::size_t mask_size = (cells + 7) / 8;
+		std::size_t table_size = has_order ? static_cast<std::size_t>(count) * order_entry_size(count) : 0;
+		if (remaining != mask_size + count + table_size)
+			throw std::runtime_error("Invalid file");
+
+		const unsigned char *mask = pos;
+		const unsigned char *records = mask + mask_size;
+		const unsigned char *table = records + count;
+
+		// with an order table the blocks are decoded in cell order first, then put in level order
+		// blocks on the start or end are null
+		std::vector<std::optional<block>> decoded;
+		if (has_order)
+			decoded.resize(count);
+
+		// the padding bits after the last cell must be clear so every set bit is a cell
+		if (cells % 8 && mask[mask_size - 1] >> (cells % 8))
+			throw std::runtime_error("Invalid file");
+
+		blocks.reserve(count);
+		std::size_t n = 0;
+		for (std::size_t i = 0; i < mask_size; ++i)
+		{
+			// only the occupied cells are visited, a byte of empty cells is skipped at once
+			for (unsigned bits = mask[i]; bits; bits &= bits - 1)
+			{
+				std::size_t cell = i * 8 + std::countr_zero(bits);
+				vec_type loc = origin + vec_type{static_cast<int>(cell % width), static_cast<int>(cell / width)};
+
+				unsigned record;
+				do
+				{
+					if (n == count)
+						throw std::runtime_error("Invalid file");
+					record = records[n++];
+
+					auto block_type = static_cast<block::type>(record & 3);
+					auto block_color = static_cast<color>(record >> 2 & 3);
+					auto dir = static_cast<direction>(record >> 4 & 3);
+					if (block_type > block::type::spike)
+						throw std::runtime_error("Invalid file");
+
+					if (loc == start || loc == end)
+						continue;
+					if (has_order)
+						decoded[n - 1].emplace(loc, block_type, block_color, dir);
+					else
+						blocks.emplace_back(loc, block_type, block_color, dir);
+				} while (record & same_cell_bit);
+			}
+		}
+
+		if (n != count)
+			throw std::runtime_error("Invalid file");
+
+		if (has_order)
+		{
+			// every record has to be used exactly once
+			std::vector<bool> used(count);
+			for (std::size_t k = 0; k < count; ++k)
+			{
+				std::uint32_t i;
+				if (order_entry_size(count) == sizeof(std::uint16_t))
+				{
+					std::uint16_t entry;
+					std::memcpy(&entry, table + k * sizeof(entry), sizeof(entry));
+					i = entry;
+				}
+				else
+					std::memcpy(&i, table + k * sizeof(i), sizeof(i));
+
+				if (i >= count || used[i])
+					throw std::runtime_error("Invalid file");
+				used[i] = true;
+
+				if (decoded[i])
+					blocks.push_back(*decoded[i]);
+			}
+		}
+
+		build_index();
+		return;
+	}
 
 	vec_type temp;
-	if (!in.read(reinterpret_cast<char *>(&temp), sizeof(temp)))
-		throw std::runtime_error("Invalid file");
+	read(temp);
 	start = temp;
 
-	if (!in.read(reinterpret_cast<char *>(&temp), sizeof(temp)))
-		throw std::runtime_error("Invalid file");
+	read(temp);
 	end = temp;
 
-	if (!in.read(reinterpret_cast<char *>(&blue_starts), sizeof(blue_starts)))
+	read(blue_starts);
+
+	// every record is checked at once, this also keeps a corrupt size from reserving a huge vector
+	if (remaining / block_record_size < size)
 		throw std::runtime_error("Invalid file");
 
-	blocks.clear();
 	blocks.reserve(size);
-	for (std::uint32_t i = 0; i < size; ++i)
+	for (std::uint32_t i = 0; i < size; ++i, pos += block_record_size)
 	{
-		block::type block_type;		
-		if (!in.read(reinterpret_cast<char *>(&block_type), sizeof(block_type)))
-			throw std::runtime_error("Invalid file");
-
-		color block_color;
-		if (!in.read(reinterpret_cast<char *>(&block_color), sizeof(block_color)))
+		// the enums are char based and so signed, the raw bytes are checked so a byte of 0x80 or more can't pass as negative
+		// the renderer indexes tables with these, so anything out of range is rejected like in v2
+		std::uint8_t raw_type = pos[0], raw_color = pos[1], raw_dir = pos[2];
+		if (raw_type > static_cast<std::uint8_t>(block::type::spike) || raw_color > static_cast<std::uint8_t>(color::no_color) || raw_dir > static_cast<std::uint8_t>(direction::left))
 			throw std::runtime_error("Invalid file");
 
-		direction dir;
-		if (!in.read(reinterpret_cast<char *>(&dir), sizeof(dir)))
-			throw std::runtime_error("Invalid file");
-		
-		if (!in.read(reinterpret_cast<char *>(&temp), sizeof(temp)))
-			throw std::runtime_error("Invalid file");
+		auto block_type = static_cast<block::type>(raw_type);
+		auto block_color = static_cast<color>(raw_color);
+		auto dir = static_cast<direction>(raw_dir);
+		std::memcpy(&temp, pos + 3, sizeof(temp));
 
 		if (temp == start || temp == end)
 			continue;
 
 		blocks.emplace_back(temp, block_type, block_color, dir);
 	}
+
+	build_index();
 }
 
-void level::write_level(const std::filesystem::path &filename)
+template <typename T>
+static void append(std::vector<unsigned char> &out, const T &field)
 {
-	auto path = filename;
-	path.replace_extension(".lvl");
+	auto bytes = reinterpret_cast<const unsigned char *>(&field);
+	out.insert(out.end(), bytes, bytes + sizeof(field));
+}
 
-	std::ofstream out(path, std::ios_base::binary);
-	if (!out)
-		throw std::runtime_error("Couldn't open file for writing");
+static std::vector<unsigned char> encode_v1(const level &l)
+{
+	std::vector<unsigned char> out;
+	out.reserve(header_tag.size() + v1_header_size + l.blocks.size() * block_record_size);
+	out.insert(out.end(), header_tag.begin(), header_tag.end());
 
-	out << header_tag;
+	append(out, static_cast<std::uint32_t>(l.blocks.size()));
+	append(out, vec_type{l.start});
+	append(out, vec_type{l.end});
+	append(out, l.blue_starts);
 
+	for (const auto &b : l.blocks)
 	{
-		std::uint32_t size = static_cast<std::uint32_t>(blocks.size());
-		out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+		append(out, b.block_type);
+		append(out, b.block_color);
+		append(out, b.dir());
+		append(out, vec_type{block_location(b)});
 	}
 
-	vec_type temp;
+	return out;
+}
 
-	temp = start;
-	out.write(reinterpret_cast<const char *>(&temp), sizeof(temp));
-	
-	temp = end;
-	out.write(reinterpret_cast<const char *>(&temp), sizeof(temp));
+// empty if the level can't be stored as v2 or v1 would be smaller
+static std::vector<unsigned char> encode_v2(const level &l)
+{
+	glm::ivec2 min = glm::min(l.start, l.end);
+	glm::ivec2 max = glm::max(l.start, l.end);
+	for (const auto &b : l.blocks)
+	{
+		glm::ivec2 loc = block_location(b);
+		min = glm::min(min, loc);
+		max = glm::max(max, loc);
+
+		// only possible for blocks made in code, files with these are rejected when read
+		if (b.block_type > block::type::spike || b.block_color > color::no_color)
+			return {};
+	}
+
+	std::int64_t width = static_cast<std::int64_t>(max.x) - min.x + 1;
+	std::int64_t height = static_cast<std::int64_t>(max.y) - min.y + 1;
+	if (width > std::numeric_limits<std::uint16_t>::max() || height > std::numeric_limits<std::uint16_t>::max())
+		return {};
 
-	out.write(reinterpret_cast<const char *>(&blue_starts), sizeof(blue_starts));
+	std::size_t mask_size = (static_cast<std::size_t>(width * height) + 7) / 8;
 
-	for (const auto &b : blocks)
+	// blocks on the start or end are dropped when reading either version, the rest are in level order
+	std::vector<std::pair<std::size_t, const block *>> cells;
+	cells.reserve(l.blocks.size());
+	for (const auto &b : l.blocks)
 	{
-		out.write(reinterpret_cast<const char *>(&b.block_type), sizeof(b.block_type));
-		out.write(reinterpret_cast<const char *>(&b.block_color), sizeof(b.block_color));
+		glm::ivec2 loc = block_location(b);
+		if (loc != l.start && loc != l.end)
+			cells.emplace_back(static_cast<std::size_t>(loc.y - min.y) * width + (loc.x - min.x), &b);
+	}
 
-		direction dir = b.dir();
-		out.write(reinterpret_cast<const char *>(&dir), sizeof(dir));
+	// blocks sharing a cell keep their order
+	std::vector<std::uint32_t> record_of(cells.size());
+	std::vector<std::uint32_t> by_cell(cells.size());
+	for (std::uint32_t i = 0; i < by_cell.size(); ++i)
+		by_cell[i] = i;
+	std::stable_sort(by_cell.begin(), by_cell.end(), [&](std::uint32_t a, std::uint32_t b) { return cells[a].first < cells[b].first; });
 
-		temp = b.poly.offset / glm::vec2(game::block_size, game::block_size);
-		out.write(reinterpret_cast<const char *>(&temp), sizeof(temp));
+	bool in_cell_order = true;
+	for (std::uint32_t n = 0; n < by_cell.size(); ++n)
+	{
+		record_of[by_cell[n]] = n;
+		in_cell_order = in_cell_order && by_cell[n] == n;
 	}
-}
 
-std::vector<level> get_levels(const std::filesystem::path &location)
-{
-	std::vector<level> levels;
+	std::size_t table_size = in_cell_order ? 0 : cells.size() * order_entry_size(cells.size());
+
+	// a few blocks spread over a big area can have a mask larger than their v1 records
+	std::size_t size = v2_header_size + mask_size + cells.size() + table_size + crc_size;
+	if (size >= v1_header_size + l.blocks.size() * block_record_size)
+		return {};
+
+	std::vector<unsigned char> out;
+	out.reserve(header_tag.size() + size);
+	out.insert(out.end(), header_tag.begin(), header_tag.end());
+
+	append(out, versioned_flag);
+	append(out, current_version);
+	append(out, vec_type{min});
+	append(out, static_cast<std::uint16_t>(width));
+	append(out, static_cast<std::uint16_t>(height));
+	append(out, static_cast<std::uint16_t>(l.start.x - min.x));
+	append(out, static_cast<std::uint16_t>(l.start.y - min.y));
+	append(out, static_cast<std::uint16_t>(l.end.x - min.x));
+	append(out, static_cast<std::uint16_t>(l.end.y - min.y));
+	append(out, static_cast<std::uint8_t>((l.blue_starts ? blue_starts_flag : 0) | (in_cell_order ? 0 : order_table_flag)));
+	append(out, static_cast<std::uint32_t>(cells.size()));
+
+	std::size_t mask = out.size();
+	out.resize(mask + mask_size, 0);
+
+	for (std::size_t n = 0; n < by_cell.size(); ++n)
+	{
+		auto [cell, b] = cells[by_cell[n]];
+		out[mask + cell / 8] |= 1 << cell % 8;
+
+		unsigned record = static_cast<unsigned>(b->block_type) | static_cast<unsigned>(b->block_color) << 2 | static_cast<unsigned>(b->dir()) << 4;
+		if (n + 1 < by_cell.size() && cells[by_cell[n + 1]].first == cell)
+			record |= same_cell_bit;
+		out.push_back(static_cast<unsigned char>(record));
+	}
 
-	auto status = std::filesystem::status(location);
-	// read singular level
-	if (status.type() == std::filesystem::file_type::regular)
+	if (!in_cell_order)
 	{
-		level new_level;
-		try
+		for (auto n : record_of)
 		{
-			new_level.read_level(location);
-		}
-		catch(const std::exception&)
-		{
-			// std::cout << "Couldn't read level " << location << ": " << e.what() << '\n';
-			new_level.construct_default();
+			if (order_entry_size(cells.size()) == sizeof(std::uint16_t))
+				append(out, static_cast<std::uint16_t>(n));
+			else
+				append(out, n);
 		}
-		levels.push_back(std::move(new_level));
 	}
-	// read multiple levels in order _n
-	else if (status.type() == std::filesystem::file_type::directory)
+
+	append(out, crc32(out.data(), out.size()));
+	return out;
+}
+
+std::vector<unsigned char> level::encode() const
+{
+	auto data = encode_v2(*this);
+	if (data.empty())
+		data = encode_v1(*this);
+	return data;
+}
+
+void level::write_level(const std::filesystem::path &filename) const
+{
+	auto path = filename;
+	path.replace_extension(".lvl");
+
+	write_file(path, encode());
+}
+
+std::optional<unsigned int> level_number(const std::filesystem::path &filename)
+{
+	static constexpr std::string_view extension = ".lvl";
+
+	// native strings are wide on windows, the name only has to be ascii where the number is
+	auto native = filename.filename().native();
+	if (native.size() <= extension.size() || !std::equal(extension.begin(), extension.end(), native.end() - extension.size()))
+		return std::nullopt;
+
+	auto digits_end = native.end() - extension.size();
+	auto digits_begin = digits_end;
+	while (digits_begin != native.begin() && digits_begin[-1] >= '0' && digits_begin[-1] <= '9')
+		--digits_begin;
+
+	if (digits_begin == digits_end || digits_begin == native.begin() || digits_begin[-1] != '_')
+		return std::nullopt;
+
+	unsigned int number = 0;
+	for (auto it = digits_begin; it != digits_end; ++it)
+	{
+		unsigned int digit = static_cast<unsigned int>(*it - '0');
+		if (number > (std::numeric_limits<unsigned int>::max() - digit) / 10)
+			return std::nullopt;
+		number = number * 10 + digit;
+	}
+
+	return number;
+}
+
+std::vector<std::pair<unsigned int, std::filesystem::path>> level_files(const std::filesystem::path &directory, std::vector<std::string> *errors)
+{
+	auto report = [&](const std::filesystem::path &path, const std::string &message)
 	{
-		static std::regex name_pattern("\\S*_(\\d*).lvl");
-		std::map<unsigned int, level> level_map;
-		for (const auto &entry : std::filesystem::directory_iterator{location})
-		{
-			if (!entry.is_regular_file())
-				continue;
+		if (errors)
+			errors->push_back(path.string() + ": " + message);
+	};
 
-			auto path = entry.path();
-			auto path_str = path.string();
+	std::vector<std::pair<unsigned int, std::filesystem::directory_entry>> candidates;
 
-			unsigned int index;
-			if (std::smatch match; std::regex_match(path_str, match, name_pattern))
-			{
-				try
-				{
-					index = std::stoul(match[1].str());
-				}
-				catch(...)
-				{
-					// std::cout << '"' << path << "\": Incorrect file name format\n";
-					continue;
-				}
-				
-			}
-			else
-			{
-				// std::cout << '"' << path << "\": Incorrect file name format\n";
-				continue;
-			}
+	// names are matched while listing, only the matches have their type checked
+	std::error_code ec;
+	std::filesystem::directory_iterator it{directory, ec};
+	for (; !ec && it != std::filesystem::directory_iterator{}; it.increment(ec))
+	{
+		if (auto number = level_number(it->path()))
+			candidates.emplace_back(*number, *it);
+		else if (it->path().extension() == ".lvl")
+			report(it->path(), "Incorrect file name format");
+	}
+	if (ec)
+		report(directory, ec.message());
 
-			level new_level;
-			try
-			{
-				new_level.read_level(path);
-			}
-			catch(const std::exception&)
-			{
-				// std::cout << "Couldn't read level " << location << ": " << e.what() << '\n';
-				continue;
-			}
+	// checking the type is a stat on file systems that don't give it while listing, which is slow over a network
+	// so a big directory is checked on every core
+	static constexpr std::size_t parallel_threshold = 256;
 
-			level_map.emplace(index, std::move(new_level));
-		}
+	std::vector<std::error_code> results(candidates.size());
+	std::vector<char> regular(candidates.size());
+	std::atomic<std::size_t> next{0};
+	auto work = [&]()
+	{
+		for (std::size_t i = next++; i < candidates.size(); i = next++)
+			regular[i] = candidates[i].second.is_regular_file(results[i]);
+	};
 
-		if (level_map.empty())
-		{
-			level new_level;
-			new_level.construct_default();
-			levels.push_back(std::move(new_level));
-		}
-		else
-		{
-			levels.reserve(level_map.size());
-			for (auto &lvl : level_map)
-				levels.push_back(std::move(lvl.second));
-		}
+	std::vector<std::thread> workers;
+	if (candidates.size() >= parallel_threshold)
+	{
+		std::size_t worker_count = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, candidates.size() / parallel_threshold);
+		for (std::size_t i = 1; i < worker_count; ++i)
+			workers.emplace_back(work);
+	}
+	work();
+	for (auto &w : workers)
+		w.join();
+
+	std::vector<std::pair<unsigned int, std::filesystem::path>> files;
+	files.reserve(candidates.size());
+	for (std::size_t i = 0; i < candidates.size(); ++i)
+	{
+		if (results[i])
+			report(candidates[i].second.path(), results[i].message());
+		else if (regular[i])
+			files.emplace_back(candidates[i].first, candidates[i].second.path());
 	}
 
-	return levels;
+	std::sort(files.begin(), files.end());
+	return files;
 }
@@ -0,0 +1,93 @@
+#include "level_batch.h"
+#include "gl_instance.h"
+
+#include <cstddef>
+
+level_batch::level_batch(const gl_instance &gl, const level &l)
+{
+	std::vector<instance> instances;
+	instances.reserve(l.blocks.size());
+
+	// (first instance, count) of each group, in the same order as m_groups
+	std::vector<std::pair<std::size_t, GLsizei>> ranges;
+
+	for (bool triangle : {false, true})
+	{
+		std::size_t first = instances.size();
+		for (const auto &b : l.blocks)
+		{
+			if ((b.block_type == block::type::spike) != triangle)
+				continue;
+
+			// no_color is drawn as neutral
+			color block_color = b.block_color == color::no_color ? color::neutral : b.block_color;
+
+			glm::vec2 x = b.poly.transform({1, 0}) - b.poly.offset;
+			glm::vec2 y = b.poly.transform({0, 1}) - b.poly.offset;
+			instances.push_back({
+				{x.x, x.y, y.x, y.y}, b.poly.offset,
+				{game_assets::block_layer(b.block_type, block_color, false), game_assets::block_layer(b.block_type, block_color, true)},
+				static_cast<GLint>(block_color)
+			});
+		}
+
+		if (instances.size() == first)
+			continue;
+
+		m_groups.push_back({triangle, static_cast<GLsizei>(instances.size() - first), vao{}});
+		ranges.emplace_back(first, m_groups.back().count);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_instances.id);
+	glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(instance), instances.data(), GL_STATIC_DRAW);
+
+	// gl 3.3 has no base instance, so each group gets a vao pointing at its part of the buffer
+	for (std::size_t i = 0; i < m_groups.size(); ++i)
+	{
+		auto &g = m_groups[i];
+		if (g.triangle)
+			gl.get_shapes().attach_triangle(g.buff);
+		else
+			gl.get_shapes().attach_square(g.buff);
+
+		std::size_t first = ranges[i].first * sizeof(instance);
+
+		glBindBuffer(GL_ARRAY_BUFFER, m_instances.id);
+		glVertexAttribPointer(instance_basis_attribute, 4, GL_FLOAT, GL_FALSE, sizeof(instance), reinterpret_cast<void *>(first + offsetof(instance, basis)));
+		glEnableVertexAttribArray(instance_basis_attribute);
+		glVertexAttribDivisor(instance_basis_attribute, 1);
+
+		glVertexAttribPointer(instance_offset_attribute, 2, GL_FLOAT, GL_FALSE, sizeof(instance), reinterpret_cast<void *>(first + offsetof(instance, offset)));
+		glEnableVertexAttribArray(instance_offset_attribute);
+		glVertexAttribDivisor(instance_offset_attribute, 1);
+
+		glVertexAttribIPointer(instance_layers_attribute, 2, GL_INT, sizeof(instance), reinterpret_cast<void *>(first + offsetof(instance, layers)));
+		glEnableVertexAttribArray(instance_layers_attribute);
+		glVertexAttribDivisor(instance_layers_attribute, 1);
+
+		glVertexAttribIPointer(instance_color_attribute, 1, GL_INT, sizeof(instance), reinterpret_cast<void *>(first + offsetof(instance, block_color)));
+		glEnableVertexAttribArray(instance_color_attribute);
+		glVertexAttribDivisor(instance_color_attribute, 1);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+}
+
+void level_batch::draw(color active_color, const gl_instance &gl, float transparency) const
+{
+	const auto &program = gl.get_instanced_texture_program();
+
+	glUseProgram(program.id);
+	program.set(uniform::ortho, gl.get_ortho());
+	program.set(uniform::transparency, transparency);
+	program.set(uniform::active_color, static_cast<GLint>(active_color));
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, gl.get_assets().blocks.id);
+
+	for (const auto &g : m_groups)
+	{
+		glBindVertexArray(g.buff.id);
+		glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, g.triangle ? 3 : 4, g.count);
+	}
+}
@@ -0,0 +1,41 @@
+#include "level_cache.h"
+#include "gl_instance.h"
+
+void level_cache::draw(color active_color, const gl_instance &gl) const
+{
+	// viewport is in pixels, which gl_instance's viewport_size isn't on high dpi screens
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	auto &l = m_layers[active_color == color::red];
+	if (!l.valid || l.target.width != viewport[2] || l.target.height != viewport[3])
+	{
+		l.target.resize(viewport[2], viewport[3]);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, l.target.id);
+		glViewport(0, 0, viewport[2], viewport[3]);
+
+		glClearColor(1, 1, 1, 1);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		// keep the layer opaque, the default blend function would write the blocks' alpha into it
+		glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+		const auto &program = gl.get_texture_program();
+		glUseProgram(program.id);
+		program.set(uniform::ortho, gl.get_ortho());
+
+		print_background(gl);
+		m_batch.draw(active_color, gl);
+
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+		l.valid = true;
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, l.target.id);
+	glBlitFramebuffer(0, 0, viewport[2], viewport[3], viewport[0], viewport[1], viewport[0] + viewport[2], viewport[1] + viewport[3], GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+}
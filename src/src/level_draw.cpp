@@ -0,0 +1,53 @@
+#include "level.h"
+#include "gl_instance.h"
+
+GLint game_assets::block_layer(block::type block_type, color block_color, bool on)
+{
+	// [type][color][on], no_color is drawn as neutral
+	static constexpr GLint layers[3][4][2] = {
+		{ // normal
+			{blue_cube_fade_layer, blue_cube_layer},
+			{red_cube_fade_layer, red_cube_layer},
+			{neutral_cube_layer, neutral_cube_layer},
+			{neutral_cube_layer, neutral_cube_layer},
+		},
+		{ // jump
+			{blue_cube_fade_layer, blue_jump_layer},
+			{red_cube_fade_layer, red_jump_layer},
+			{neutral_jump_layer, neutral_jump_layer},
+			{neutral_jump_layer, neutral_jump_layer},
+		},
+		{ // spike
+			{blue_spike_fade_layer, blue_spike_layer},
+			{red_spike_fade_layer, red_spike_layer},
+			{neutral_spike_layer, neutral_spike_layer},
+			{neutral_spike_layer, neutral_spike_layer},
+		},
+	};
+
+	return layers[static_cast<int>(block_type)][static_cast<int>(block_color)][on];
+}
+
+void block::draw(color active_color, const gl_instance &gl, float transparency) const
+{
+	bool on = active_color == color::no_color || active_color == block_color || block_color == color::neutral;
+
+	const vao *buff = block_type == block::type::spike ? &gl.get_shapes().triangle_vao() : &gl.get_shapes().square_vao();
+
+	auto m = model(poly.offset, poly.scale, poly.angle);
+	const auto &program = gl.get_layer_texture_program();
+	program.set(uniform::model, m);
+	program.set(uniform::transparency, transparency);
+	program.set(uniform::layer, game_assets::block_layer(block_type, block_color, on));
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, gl.get_assets().blocks.id);
+
+	glBindVertexArray(buff->id);
+	glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(poly.size()));
+}
+
+void level::draw(color active_color, const gl_instance &gl) const
+{
+	for (const auto &b : blocks)
+		b.draw(active_color, gl);
+}
@@ -6,14 +6,23 @@
 #include "button.h"
 
 #include "menu.h"
+#include "level_grid.h"
+#include "edit_history.h"
+#include "autosave.h"
 
 #include <string>
 #include <limits>
 #include <thread>
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include <optional>
+#include <vector>
 
 #include <tinyfiledialogs.h>
 
-void run_level_editor(gl_instance &gl, level &l);
+// autosave_path is where snapshots of the level are written while it's edited
+void run_level_editor(gl_instance &gl, level &l, const std::filesystem::path &autosave_path);
 
 int main()
 {
@@ -92,11 +101,16 @@ int main()
 						"S/Down: Scroll Color Down\n"
 						"A/Left: Rotate CCW\n"
 						"D/Right: Rotate CW\n"
+						"1/2/3/4: Brush/Line/Rectangle/Fill Tool\n"
+						"Ctrl+Z: Undo\n"
+						"Ctrl+Y/Ctrl+Shift+Z: Redo\n"
 						"Tips\n"
 						"--------------------------------------\n"
 						"You can place multiple spikes in the same block.\n"
 						"Use pick block to speed up the process.\n"
+						"Edits are autosaved to *level*.lvl.autosave, rename it to recover them.\n"
 						"You can click and drag place block and erase block for quicker editing.\n"
+						"Right drag a line or rectangle, or right click with fill to erase whole blocks.\n"
 						"You can use the bottom of a spike as a floor or ceiling and the player won't die.\n"
 						"After initial editing is finished, place spawn anchor (green), and end anchor (red).\n"
 						"For levels to work with the game, keep the outside wall and add an opening that will lead into another level.\n"
@@ -109,24 +123,38 @@ int main()
 		// play level
 		if (option == play_level)
 		{
-			run_game(gl, std::ranges::single_view{l});
+			run_game(gl, std::ranges::single_view{level_handle(l)});
 			continue;
 		}
 
-		run_level_editor(gl, l);
+		// next to the level, the extension keeps the game from loading it
+		std::filesystem::path autosave_path = filename.empty() ? std::filesystem::path(cwd) / "untitled.lvl" : filename;
+		autosave_path += ".autosave";
+
+		run_level_editor(gl, l, autosave_path);
 
 		while (yes_no(gl, "Play level?"))
 		{
-			run_game(gl, std::ranges::single_view{l});
+			run_game(gl, std::ranges::single_view{level_handle(l)});
 
 			if (yes_no(gl, "Continue editing?"))
-				run_level_editor(gl, l);
+				run_level_editor(gl, l, autosave_path);
 			else
 				break;
 		}
 
+		// the autosave is only a draft, once the level is saved or thrown away it would just be stale
+		auto discard_autosave = [&]()
+		{
+			std::error_code ec;
+			std::filesystem::remove(autosave_path, ec);
+		};
+
 		if (!yes_no(gl, "Save level?"))
+		{
+			discard_autosave();
 			continue;
+		}
 
 		bool save = true;
 
@@ -158,6 +186,7 @@ int main()
 				try
 				{
 					l.write_level(filename);
+					discard_autosave();
 					message(gl, "Successfully saved level " + filename.filename().string() + '\n');
 					break;
 				}
@@ -185,17 +214,6 @@ int WinMain()
 }
 #endif
 
-// loc is location on target screen
-auto find_block(level &l, glm::vec2 loc)
-{
-	polygon_view poly(square(), loc, {10, 10}, 0);
-	auto it = l.blocks.begin();
-	for (; it < l.blocks.end(); ++it)
-		if (collides(poly, it->poly))
-			return it;
-	return it;
-}
-
 block::type current_type;
 
 void scroll_callback(GLFWwindow *window, double xoffset, double yoffset)
@@ -221,7 +239,7 @@ void spawn_end_scroll_callback(GLFWwindow *window, double xoffset, double yoffse
 	end_block_type = static_cast<spawn_or_end>(next);
 }
 
-void run_level_editor(gl_instance &gl, level &l)
+void run_level_editor(gl_instance &gl, level &l, const std::filesystem::path &autosave_path)
 {
 	const auto &win = gl.get_window();
 
@@ -237,6 +255,66 @@ void run_level_editor(gl_instance &gl, level &l)
 
 	block current_block;
 
+	enum class tool
+	{
+		brush,
+		line,
+		rectangle,
+		fill,
+	};
+	static constexpr const char *tool_names[] = {"Brush", "Line", "Rectangle", "Fill"};
+	tool current_tool = tool::brush;
+
+	// the first cell of the line or rectangle being dragged, whether it erases and the cells it covers
+	std::optional<glm::ivec2> shape_start;
+	bool shape_erase = false;
+	std::vector<glm::ivec2> shape;
+
+	// edited by cell, l.blocks is only written back when editing is done
+	level_grid grid(l);
+	// a step per click or drag, only while editing blocks
+	edit_history history;
+
+	using namespace std::chrono_literals;
+	static constexpr auto autosave_interval = 30s;
+
+	// wakes up the event loop when a save finishes so the status is redrawn
+	autosave saver(glfwPostEmptyEvent);
+	// changed since the last autosave
+	bool dirty = false;
+	auto next_autosave = std::chrono::steady_clock::now() + autosave_interval;
+
+	text status_text(gl.get_font());
+	std::string status_string;
+	auto update_status = [&]()
+	{
+		static constexpr float height = 16.f;
+
+		auto status = saver.get_status();
+		char buffer[128] = "";
+		if (status.saving)
+			std::snprintf(buffer, sizeof(buffer), "  Autosaving...");
+		else if (!status.error.empty())
+			std::snprintf(buffer, sizeof(buffer), "  Autosave failed: %.80s", status.error.c_str());
+		else if (status.saved)
+			std::snprintf(buffer, sizeof(buffer), "  Autosaved in %.2f ms", std::chrono::duration<double, std::milli>(status.latency).count());
+		std::string str = tool_names[static_cast<int>(current_tool)] + std::string(buffer);
+		if (status.skipped)
+			str += ", " + std::to_string(status.skipped) + " skipped";
+
+		if (str == status_string)
+			return;
+		status_string = str;
+
+		status_text.set_string(str);
+		status_text.set_text_scale({1, 1});
+
+		rect bound = status_text.get_local_rect();
+		float scale_diff = height / bound.dims.y;
+		status_text.set_text_scale({scale_diff, scale_diff});
+		status_text.set_text_origin(glm::vec2{10, 10} - bound.min * scale_diff);
+	};
+
 	auto draw = [&]()
 	{
 		const auto &program = gl.get_texture_program();
@@ -246,17 +324,29 @@ void run_level_editor(gl_instance &gl, level &l)
 
 		// set uniforms
 		glUseProgram(program.id);
-		glUniformMatrix4fv(glGetUniformLocation(program.id, "ortho"), 1, GL_FALSE, &gl.get_ortho()[0][0]);
+		program.set(uniform::ortho, gl.get_ortho());
 
 		print_background(gl);
 
-		l.draw(color::no_color, gl);
-		current_block.draw(color::no_color, gl, .75f);
+		const auto &layer_program = gl.get_layer_texture_program();
+		glUseProgram(layer_program.id);
+		layer_program.set(uniform::ortho, gl.get_ortho());
+
+		grid.for_each([&](const block &b) { b.draw(color::no_color, gl); });
+		if (shape.empty())
+			current_block.draw(color::no_color, gl, .75f);
+		else if (!shape_erase)
+			for (auto c : shape)
+				block(c, current_type, current_color, current_dir).draw(color::no_color, gl, .75f);
+
+		update_status();
+		status_text.draw(gl);
 
 		glfwSwapBuffers(win.handle);
 	};
 
-	gl.register_draw_function(draw);
+	// draw_2 replaces it below, either is cleared when editing ends
+	scoped_draw_function registration(gl, draw);
 
 	key right_click;
 	key pick_block;
@@ -265,16 +355,33 @@ void run_level_editor(gl_instance &gl, level &l)
 	key angle_right;
 	key angle_left;
 	key type_up;
+	key undo;
+	key redo;
+	key tool_keys[4];
 
-	bool has_spawn = true;
-	bool has_end = true;
+	// an autosave taken after an anchor was painted over stores it outside the map, it has to be placed again before leaving
+	bool has_spawn = level_grid::in_bounds(l.start);
+	bool has_end = level_grid::in_bounds(l.end);
+
+	auto get_anchors = [&]() { return edit_history::anchors{l.start, l.end, has_spawn, has_end}; };
+	auto set_anchors = [&](const edit_history::anchors &a)
+	{
+		l.start = a.start;
+		l.end = a.end;
+		has_spawn = a.has_spawn;
+		has_end = a.has_end;
+	};
 
 	// so that a block is not immediately placed when entering level editor
 	bool left_released = false;
 
 	while (!glfwWindowShouldClose(win.handle))
 	{
-		glfwWaitEvents();
+		// wake up for the next autosave if there's something to save
+		if (dirty)
+			glfwWaitEventsTimeout(std::max(std::chrono::duration<double>(next_autosave - std::chrono::steady_clock::now()).count(), 0.));
+		else
+			glfwWaitEvents();
 
 		gl.get_escape_key().update(glfwGetKey(win.handle, GLFW_KEY_ESCAPE));
 		if (gl.get_escape_key().is_initial_press())
@@ -292,50 +399,151 @@ void run_level_editor(gl_instance &gl, level &l)
 		angle_right.update(glfwGetKey(win.handle, GLFW_KEY_D) || glfwGetKey(win.handle, GLFW_KEY_RIGHT));
 		angle_left.update(glfwGetKey(win.handle, GLFW_KEY_A) || glfwGetKey(win.handle, GLFW_KEY_LEFT));
 
+		bool ctrl = glfwGetKey(win.handle, GLFW_KEY_LEFT_CONTROL) || glfwGetKey(win.handle, GLFW_KEY_RIGHT_CONTROL);
+		bool shift = glfwGetKey(win.handle, GLFW_KEY_LEFT_SHIFT) || glfwGetKey(win.handle, GLFW_KEY_RIGHT_SHIFT);
+		undo.update(ctrl && !shift && glfwGetKey(win.handle, GLFW_KEY_Z));
+		redo.update(ctrl && (glfwGetKey(win.handle, GLFW_KEY_Y) || (shift && glfwGetKey(win.handle, GLFW_KEY_Z))));
+
+		for (int i = 0; i < 4; ++i)
+		{
+			tool_keys[i].update(glfwGetKey(win.handle, GLFW_KEY_1 + i));
+			if (tool_keys[i].is_initial_press() && current_tool != static_cast<tool>(i))
+			{
+				current_tool = static_cast<tool>(i);
+				shape_start.reset();
+				shape.clear();
+			}
+		}
+
 		glm::dvec2 mouse_pos = get_mouse_pos(gl);
 
 		glm::ivec2 grid_pos{mouse_pos / (double)game::block_size};
 
 		current_block = block(grid_pos, current_type, current_color, current_dir);
-		
-		// place block (if in bounds)
-		if (left_released && gl.get_left_click().is_pressed() && grid_pos.x >= 0 && grid_pos.x < game::map_width && grid_pos.y >= 0 && grid_pos.y < game::map_height)
+		bool in_bounds = level_grid::in_bounds(grid_pos);
+
+		// a block placed on an anchor removes it, as part of the step so undo puts it back
+		auto paint_over_anchor = [&](glm::ivec2 c)
 		{
-			if (has_spawn && grid_pos == l.start)
+			if ((has_spawn && c == l.start) || (has_end && c == l.end))
+				history.touch_anchors(get_anchors());
+			if (has_spawn && c == l.start)
 				has_spawn = false;
-			else if (has_end && grid_pos == l.end)
+			else if (has_end && c == l.end)
 				has_end = false;
-			// could be in an else but I'll leave it out for a failsafe
-			// erase any blocks that were there before
-			while (true)
+		};
+
+		// places the current block on or erases every cell as one step
+		auto apply = [&](const std::vector<glm::ivec2> &cells, bool erase)
+		{
+			for (auto c : cells)
 			{
-				auto it = find_block(l, current_block.poly.offset);
-				if (it != l.blocks.end())
-					l.blocks.erase(it);
-				else
-					break;
+				history.touch(grid, c);
+				if (erase)
+				{
+					grid.clear(c);
+					continue;
+				}
+
+				paint_over_anchor(c);
+				grid.place(block(c, current_type, current_color, current_dir));
 			}
+			history.commit(grid, get_anchors());
+			dirty = dirty || !cells.empty();
+		};
 
-			l.blocks.push_back(current_block);
+		switch (current_tool)
+		{
+		case tool::brush:
+			// place block (if in bounds)
+			if (left_released && gl.get_left_click().is_pressed() && in_bounds)
+			{
+				paint_over_anchor(grid_pos);
+				// replaces any blocks that were there before
+				history.touch(grid, grid_pos);
+				grid.place(current_block);
+				dirty = true;
+			}
+
+			// remove block
+			if (right_click.is_pressed())
+			{
+				if (auto cell = grid.find_cell(mouse_pos))
+				{
+					history.touch(grid, *cell);
+					grid.remove(mouse_pos);
+					dirty = true;
+				}
+			}
+			break;
+		case tool::line:
+		case tool::rectangle:
+			if (!shape_start && in_bounds && ((left_released && gl.get_left_click().is_initial_press()) || right_click.is_initial_press()))
+			{
+				shape_start = grid_pos;
+				shape_erase = !gl.get_left_click().is_pressed();
+			}
+
+			if (shape_start)
+			{
+				glm::ivec2 end = glm::clamp(grid_pos, glm::ivec2(0), glm::ivec2(level_grid::width - 1, level_grid::height - 1));
+				shape = current_tool == tool::line ? level_grid::line_cells(*shape_start, end) : level_grid::rect_cells(*shape_start, end);
+
+				// applied when the button that started it is let go
+				if (!(shape_erase ? right_click : gl.get_left_click()).is_pressed())
+				{
+					apply(shape, shape_erase);
+					shape_start.reset();
+					shape.clear();
+				}
+			}
+			break;
+		case tool::fill:
+			if (in_bounds && left_released && gl.get_left_click().is_initial_press())
+				apply(grid.flood_cells(grid_pos), false);
+			else if (in_bounds && right_click.is_initial_press())
+				apply(grid.flood_cells(grid_pos), true);
+			break;
 		}
 
-		// remove block
-		if (right_click.is_pressed())
+		// a drag is one step, it ends when both buttons are up
+		if (!gl.get_left_click().is_pressed() && !right_click.is_pressed())
+			history.commit(grid, get_anchors());
+
+		if (auto a = get_anchors(); undo.is_initial_press() && history.undo(grid, a))
+		{
+			set_anchors(a);
+			dirty = true;
+		}
+		if (auto a = get_anchors(); redo.is_initial_press() && history.redo(grid, a))
 		{
-			// erase block at mouse pos
-			auto it = find_block(l, mouse_pos);
-			if (it != l.blocks.end())
-				l.blocks.erase(it);
+			set_anchors(a);
+			dirty = true;
+		}
+
+		// saves a copy so editing can go on while it's written, a save that's still being written skips this one
+		if (auto now = std::chrono::steady_clock::now(); dirty && now >= next_autosave)
+		{
+			// an anchor that has been painted over is moved outside the map, the block on its cell would be dropped when read otherwise
+			auto snapshot = std::make_shared<level>();
+			snapshot->start = has_spawn ? l.start : glm::ivec2{-1, -1};
+			snapshot->end = has_end ? l.end : glm::ivec2{-1, -1};
+			snapshot->blue_starts = l.blue_starts;
+			grid.write(*snapshot);
+
+			if (saver.save(std::move(snapshot), autosave_path))
+				dirty = false;
+			next_autosave = now + autosave_interval;
 		}
 		
 		// pick block
 		if (pick_block.is_initial_press())
 		{
-			if (auto it = find_block(l, mouse_pos); it != l.blocks.end())
+			if (const block *b = grid.find(mouse_pos))
 			{
-				current_dir = it->dir();
-				current_color = it->block_color;
-				current_type = it->block_type;
+				current_dir = b->dir();
+				current_color = b->block_color;
+				current_type = b->block_type;
 			}
 		}
 
@@ -367,16 +575,23 @@ void run_level_editor(gl_instance &gl, level &l)
 		glClearColor(1, 1, 1, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
-		const auto &program = gl.get_texture_program();
+		const auto &texture_program = gl.get_texture_program();
 
 		// set uniforms
-		glUseProgram(program.id);
-		glUniformMatrix4fv(glGetUniformLocation(program.id, "ortho"), 1, GL_FALSE, &gl.get_ortho()[0][0]);
+		glUseProgram(texture_program.id);
+		texture_program.set(uniform::ortho, gl.get_ortho());
 
 		print_background(gl);
 
-		l.draw(color::no_color, gl);
+		// blocks and anchors are layers of the same texture array
+		const auto &program = gl.get_layer_texture_program();
+		glUseProgram(program.id);
+		program.set(uniform::ortho, gl.get_ortho());
+
+		grid.for_each([&](const block &b) { b.draw(color::no_color, gl); });
 		
+		program.set(uniform::transparency, 1.f);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, gl.get_assets().blocks.id);
 		glBindVertexArray(gl.get_shapes().square_vao().id);
 		
 		if (has_spawn)
@@ -386,9 +601,9 @@ void run_level_editor(gl_instance &gl, level &l)
 			loc.y += game::block_size / 2;
 
 			auto m = glm::scale(glm::translate(glm::mat4(1.f), {loc, 0}), {game::block_size, game::block_size, 0});
-			glUniformMatrix4fv(glGetUniformLocation(program.id, "model"), 1, GL_FALSE, &m[0][0]);
+			program.set(uniform::model, m);
 
-			glBindTexture(GL_TEXTURE_2D, gl.get_assets().spawn_anchor.id);
+			program.set(uniform::layer, game_assets::spawn_anchor_layer);
 			glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 		}
 
@@ -399,21 +614,20 @@ void run_level_editor(gl_instance &gl, level &l)
 			loc.y += game::block_size / 2;
 
 			auto m = glm::scale(glm::translate(glm::mat4(1.f), {loc, 0}), {game::block_size, game::block_size, 0});
-			glUniformMatrix4fv(glGetUniformLocation(program.id, "model"), 1, GL_FALSE, &m[0][0]);
+			program.set(uniform::model, m);
 
-			glBindTexture(GL_TEXTURE_2D, gl.get_assets().end_anchor.id);
+			program.set(uniform::layer, game_assets::end_anchor_layer);
 			glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 		}
 
-		const texture *text = end_block_type == spawn_or_end::end ? &gl.get_assets().end_anchor : &gl.get_assets().spawn_anchor;
+		GLint layer = end_block_type == spawn_or_end::end ? game_assets::end_anchor_layer : game_assets::spawn_anchor_layer;
 		glm::vec2 loc = grid_pos * game::block_size;
 		loc.x += game::block_size / 2;
 		loc.y += game::block_size / 2;
 		auto m = glm::scale(glm::translate(glm::mat4(1.f), {loc, 0}), {game::block_size, game::block_size, 0});
-		glUniformMatrix4fv(glGetUniformLocation(program.id, "model"), 1, GL_FALSE, &m[0][0]);
-		glUniform1f(glGetUniformLocation(gl.get_texture_program().id, "transparency"), .75f);
-
-		glBindTexture(GL_TEXTURE_2D, text->id);
+		program.set(uniform::model, m);
+		program.set(uniform::transparency, .75f);
+		program.set(uniform::layer, layer);
 		glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 
 		glfwSwapBuffers(win.handle);
@@ -473,14 +687,7 @@ void run_level_editor(gl_instance &gl, level &l)
 			else
 			{
 				// erase any blocks that were there before
-				while (true)
-				{
-					auto it = find_block(l, grid_pos * game::block_size + glm::ivec2(game::block_size, game::block_size) / 2);
-					if (it != l.blocks.end())
-						l.blocks.erase(it);
-					else
-						break;
-				}
+				grid.clear(grid_pos);
 			}
 
 			if (end_block_type == spawn_or_end::spawn)
@@ -507,4 +714,6 @@ void run_level_editor(gl_instance &gl, level &l)
 	}
 
 	glfwSetScrollCallback(win.handle, nullptr);
+
+	grid.write(l);
 }
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include "level_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+// same size as the square the editor has always picked blocks with
+static constexpr float pick_size = 10;
+
+static glm::ivec2 cell_of(glm::vec2 loc)
+{
+	return {static_cast<int>(std::floor(loc.x / game::block_size)), static_cast<int>(std::floor(loc.y / game::block_size))};
+}
+
+level_grid::level_grid(const level &l) : level_grid()
+{
+	for (const auto &b : l.blocks)
+	{
+		if (in_bounds(cell_of(b.poly.offset)))
+			place(b, m_next, &m_hidden);
+		else
+			m_outside.emplace_back(m_next, b);
+		++m_next;
+	}
+}
+
+std::pair<glm::ivec2, int> level_grid::find_slot(glm::vec2 loc) const
+{
+	polygon_view poly(square(), loc, {pick_size, pick_size}, 0);
+
+	// the square can reach into the neighbouring cells near an edge, widened slightly so blocks only touching it are found
+	glm::ivec2 first = cell_of(loc - pick_size / 2 - 1.f);
+	glm::ivec2 last = cell_of(loc + pick_size / 2 + 1.f);
+	for (int y = first.y; y <= last.y; ++y)
+	{
+		for (int x = first.x; x <= last.x; ++x)
+		{
+			if (!in_bounds({x, y}))
+				continue;
+
+			const cell &c = at({x, y});
+			for (int i = 0; i < slot_count; ++i)
+				if (c.used & 1 << i && collides(poly, c.slots[i].shape))
+					return {{x, y}, i};
+		}
+	}
+
+	return {{}, -1};
+}
+
+const block *level_grid::find(glm::vec2 loc) const
+{
+	auto [c, i] = find_slot(loc);
+	if (i < 0)
+		return nullptr;
+	return &at(c).slots[i];
+}
+
+void level_grid::place(const block &b, sequence order, std::vector<std::pair<sequence, block>> *hidden)
+{
+	cell &c = at(cell_of(b.poly.offset));
+	int i = slot(b);
+	std::uint8_t replaced = c.used & (i == 0 ? 0xff : 1 | 1 << i);
+	if (hidden)
+		for (int j = 0; j < slot_count; ++j)
+			if (replaced & 1 << j)
+				hidden->emplace_back(c.order[j], c.slots[j]);
+
+	c.used &= ~replaced;
+	c.slots[i] = b;
+	c.order[i] = order;
+	c.used |= 1 << i;
+}
+
+void level_grid::edited(glm::ivec2 c)
+{
+	if (!m_hidden.empty())
+		std::erase_if(m_hidden, [&](const auto &h) { return cell_of(h.second.poly.offset) == c; });
+}
+
+void level_grid::place(const block &b)
+{
+	glm::ivec2 loc = cell_of(b.poly.offset);
+	if (!in_bounds(loc))
+		return;
+
+	edited(loc);
+	const cell &c = at(loc);
+	int i = slot(b);
+	place(b, c.used & 1 << i ? c.order[i] : m_next++, nullptr);
+}
+
+bool level_grid::remove(glm::vec2 loc)
+{
+	auto [c, i] = find_slot(loc);
+	if (i < 0)
+		return false;
+
+	edited(c);
+	at(c).used &= ~(1 << i);
+	return true;
+}
+
+void level_grid::clear(glm::ivec2 cell)
+{
+	if (!in_bounds(cell))
+		return;
+
+	edited(cell);
+	at(cell).used = 0;
+}
+
+std::optional<glm::ivec2> level_grid::find_cell(glm::vec2 loc) const
+{
+	auto [c, i] = find_slot(loc);
+	if (i < 0)
+		return {};
+	return c;
+}
+
+// bits of a cell_state after the 5 bit used mask
+static constexpr int type_shift = 5;
+static constexpr int color_shift = type_shift + 1;
+static constexpr int dir_shift = color_shift + 2;
+static constexpr int spike_color_shift = dir_shift + 2;
+
+level_grid::cell_state level_grid::state(glm::ivec2 cell) const
+{
+	static_assert(type_shift == slot_count && spike_color_shift + 2 * (slot_count - 1) == cell_state_bits);
+
+	const auto &c = at(cell);
+	cell_state s = c.used;
+	if (c.used & 1)
+	{
+		const block &b = c.slots[0];
+		s |= static_cast<cell_state>(b.block_type == block::type::jump) << type_shift;
+		s |= static_cast<cell_state>(b.block_color) << color_shift;
+		s |= static_cast<cell_state>(b.dir()) << dir_shift;
+	}
+	for (int i = 1; i < slot_count; ++i)
+		if (c.used & 1 << i)
+			s |= static_cast<cell_state>(c.slots[i].block_color) << (spike_color_shift + 2 * (i - 1));
+	return s;
+}
+
+void level_grid::set_state(glm::ivec2 cell, cell_state s)
+{
+	edited(cell);
+	auto &c = at(cell);
+	c.used = s & ((1 << slot_count) - 1);
+	for (int i = 0; i < slot_count; ++i)
+		if (c.used & 1 << i && c.order[i] == no_sequence)
+			c.order[i] = m_next++;
+	if (c.used & 1)
+	{
+		auto t = s >> type_shift & 1 ? block::type::jump : block::type::normal;
+		c.slots[0] = block(cell, t, static_cast<color>(s >> color_shift & 3), static_cast<direction>(s >> dir_shift & 3));
+	}
+	for (int i = 1; i < slot_count; ++i)
+		if (c.used & 1 << i)
+			c.slots[i] = block(cell, block::type::spike, static_cast<color>(s >> (spike_color_shift + 2 * (i - 1)) & 3), static_cast<direction>(i - 1));
+}
+
+std::vector<glm::ivec2> level_grid::rect_cells(glm::ivec2 a, glm::ivec2 b)
+{
+	glm::ivec2 min = glm::max(glm::min(a, b), glm::ivec2(0));
+	glm::ivec2 max = glm::min(glm::max(a, b), glm::ivec2(width - 1, height - 1));
+
+	std::vector<glm::ivec2> res;
+	for (int y = min.y; y <= max.y; ++y)
+		for (int x = min.x; x <= max.x; ++x)
+			res.push_back({x, y});
+	return res;
+}
+
+std::vector<glm::ivec2> level_grid::line_cells(glm::ivec2 a, glm::ivec2 b)
+{
+	// bresenham
+	glm::ivec2 d = glm::abs(b - a);
+	glm::ivec2 step{b.x < a.x ? -1 : 1, b.y < a.y ? -1 : 1};
+	int error = d.x - d.y;
+
+	std::vector<glm::ivec2> res;
+	for (glm::ivec2 cur = a;; )
+	{
+		if (in_bounds(cur))
+			res.push_back(cur);
+		if (cur == b)
+			break;
+
+		int e2 = 2 * error;
+		if (e2 > -d.y)
+		{
+			error -= d.y;
+			cur.x += step.x;
+		}
+		if (e2 < d.x)
+		{
+			error += d.x;
+			cur.y += step.y;
+		}
+	}
+	return res;
+}
+
+std::vector<glm::ivec2> level_grid::flood_cells(glm::ivec2 start) const
+{
+	std::vector<glm::ivec2> res;
+	if (!in_bounds(start))
+		return res;
+
+	cell_state target = state(start);
+	std::vector<bool> seen(m_cells.size());
+	seen[start.y * width + start.x] = true;
+	res.push_back(start);
+
+	// res doubles as the queue, everything before i has had its neighbours checked
+	for (std::size_t i = 0; i < res.size(); ++i)
+	{
+		static const glm::ivec2 neighbours[] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+		for (auto n : neighbours)
+		{
+			glm::ivec2 c = res[i] + n;
+			if (!in_bounds(c) || seen[c.y * width + c.x] || state(c) != target)
+				continue;
+
+			seen[c.y * width + c.x] = true;
+			res.push_back(c);
+		}
+	}
+	return res;
+}
+
+void level_grid::write(level &l) const
+{
+	std::vector<std::pair<sequence, const block *>> ordered;
+	for (const auto &c : m_cells)
+		for (int i = 0; i < slot_count; ++i)
+			if (c.used & 1 << i)
+				ordered.emplace_back(c.order[i], &c.slots[i]);
+	for (const auto &[order, b] : m_outside)
+		ordered.emplace_back(order, &b);
+	for (const auto &[order, b] : m_hidden)
+		ordered.emplace_back(order, &b);
+
+	std::sort(ordered.begin(), ordered.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+	l.blocks.clear();
+	l.blocks.reserve(ordered.size());
+	for (const auto &[order, b] : ordered)
+		l.blocks.push_back(*b);
+	l.build_index();
+}
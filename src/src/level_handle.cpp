@@ -0,0 +1,142 @@
+#include "level_handle.h"
+#include "level_pack.h"
+
+level_handle::level_handle(std::filesystem::path filename) : m_state{std::make_shared<state>()}
+{
+	m_state->filenames.push_back(std::move(filename));
+}
+
+level_handle::level_handle(std::vector<std::filesystem::path> filenames) : m_state{std::make_shared<state>()}
+{
+	m_state->filenames = std::move(filenames);
+}
+
+level_handle::level_handle(std::shared_ptr<const level_pack> pack, std::size_t index) : m_state{std::make_shared<state>()}
+{
+	m_state->pack = std::move(pack);
+	m_state->index = index;
+}
+
+level_handle::level_handle(level l) : m_state{std::make_shared<state>()}
+{
+	m_state->owned = std::make_shared<const level>(std::move(l));
+	m_state->loaded = m_state->owned;
+}
+
+std::shared_ptr<const level> level_handle::state::read() const
+{
+	if (pack)
+	{
+		try
+		{
+			return std::make_shared<const level>(pack->get(index));
+		}
+		catch (const std::exception &)
+		{
+			return nullptr;
+		}
+	}
+
+	for (const auto &filename : filenames)
+	{
+		try
+		{
+			level res;
+			res.read_level(filename);
+			return std::make_shared<const level>(std::move(res));
+		}
+		catch (const std::exception &)
+		{
+			// std::cout << "Couldn't read level " << filename << ": " << e.what() << '\n';
+		}
+	}
+	return nullptr;
+}
+
+std::shared_ptr<const level> level_handle::get() const
+{
+	std::lock_guard lock(m_state->mutex);
+
+	if (auto l = m_state->loaded.lock())
+		return l;
+	if (m_state->unreadable)
+		return nullptr;
+
+	std::shared_ptr<const level> l;
+	if (m_state->pending.valid())
+		l = m_state->pending.get();
+	else
+		l = m_state->read();
+
+	m_state->unreadable = !l;
+	m_state->loaded = l;
+	return l;
+}
+
+void level_handle::prefetch() const
+{
+	std::lock_guard lock(m_state->mutex);
+
+	if (!m_state->loaded.expired() || m_state->unreadable || m_state->pending.valid())
+		return;
+
+	// only reads the source members, which never change after construction
+	m_state->pending = std::async(std::launch::async, [s = m_state.get()]
+	{
+		return s->read();
+	});
+}
+
+std::vector<level_handle> get_levels(const std::filesystem::path &location, std::vector<std::string> *errors)
+{
+	std::vector<level_handle> levels;
+
+	std::error_code ec;
+	auto status = std::filesystem::status(location, ec);
+	if (ec && errors)
+		errors->push_back(location.string() + ": " + ec.message());
+
+	// every level of a pack in order, only the index is read
+	if (status.type() == std::filesystem::file_type::regular && location.extension() == ".lvlpack")
+	{
+		try
+		{
+			auto pack = std::make_shared<const level_pack>(location);
+			levels.reserve(pack->size());
+			for (std::size_t i = 0; i < pack->size(); ++i)
+				levels.emplace_back(pack, i);
+		}
+		catch (const std::exception &e)
+		{
+			if (errors)
+				errors->push_back(location.string() + ": " + e.what());
+		}
+	}
+	// singular level
+	else if (status.type() == std::filesystem::file_type::regular)
+		levels.emplace_back(location);
+	// multiple levels in order _n, the first readable file of each number is used
+	else if (status.type() == std::filesystem::file_type::directory)
+	{
+		auto files = level_files(location, errors);
+		levels.reserve(files.size());
+		for (std::size_t i = 0; i < files.size();)
+		{
+			std::vector<std::filesystem::path> same_number;
+			std::size_t j = i;
+			for (; j < files.size() && files[j].first == files[i].first; ++j)
+				same_number.push_back(std::move(files[j].second));
+			levels.emplace_back(std::move(same_number));
+			i = j;
+		}
+	}
+
+	if (levels.empty())
+	{
+		level new_level;
+		new_level.construct_default();
+		levels.emplace_back(std::move(new_level));
+	}
+
+	return levels;
+}
@@ -0,0 +1,86 @@
+#include "level_pack.h"
+
+#include <cstring>
+#include <stdexcept>
+
+static const std::string pack_tag = "MapJumpLevelPack";
+static constexpr std::uint32_t pack_version = 1;
+static constexpr std::size_t pack_header_size = 2 * sizeof(std::uint32_t);
+static constexpr std::size_t entry_size = 2 * sizeof(std::uint64_t);
+
+level_pack::level_pack(const std::filesystem::path &filename)
+{
+	if (filename.extension() != ".lvlpack")
+		throw std::runtime_error("Can only read .lvlpack files");
+
+	m_file = mapped_file(filename);
+
+	const unsigned char *data = m_file.data();
+	std::size_t size = m_file.size();
+
+	if (size < pack_tag.size() + pack_header_size || std::memcmp(data, pack_tag.data(), pack_tag.size()) != 0)
+		throw std::runtime_error("Invalid file");
+
+	std::uint32_t version, count;
+	std::memcpy(&version, data + pack_tag.size(), sizeof(version));
+	std::memcpy(&count, data + pack_tag.size() + sizeof(version), sizeof(count));
+
+	std::size_t index_begin = pack_tag.size() + pack_header_size;
+	if (version != pack_version || (size - index_begin) / entry_size < count)
+		throw std::runtime_error("Invalid file");
+
+	m_index.resize(count);
+	std::memcpy(m_index.data(), data + index_begin, count * entry_size);
+
+	for (const auto &e : m_index)
+		if (e.offset > size || e.size > size - e.offset)
+			throw std::runtime_error("Invalid file");
+}
+
+std::span<const unsigned char> level_pack::level_data(std::size_t i) const
+{
+	const entry &e = m_index.at(i);
+	return {m_file.data() + e.offset, static_cast<std::size_t>(e.size)};
+}
+
+level level_pack::get(std::size_t i) const
+{
+	level res;
+	res.read_level(level_data(i));
+	return res;
+}
+
+void level_pack::write(const std::filesystem::path &filename, const std::vector<std::span<const unsigned char>> &levels)
+{
+	auto path = filename;
+	path.replace_extension(".lvlpack");
+
+	std::uint32_t count = static_cast<std::uint32_t>(levels.size());
+
+	std::vector<entry> index;
+	index.reserve(levels.size());
+	std::uint64_t offset = pack_tag.size() + pack_header_size + levels.size() * entry_size;
+	for (const auto &l : levels)
+	{
+		index.push_back({offset, l.size()});
+		offset += l.size();
+	}
+
+	// built in memory and written in one go so an interrupted write can't leave a truncated pack
+	std::vector<unsigned char> out;
+	out.reserve(offset);
+	auto append = [&](const void *data, std::size_t size)
+	{
+		auto bytes = static_cast<const unsigned char *>(data);
+		out.insert(out.end(), bytes, bytes + size);
+	};
+
+	append(pack_tag.data(), pack_tag.size());
+	append(&pack_version, sizeof(pack_version));
+	append(&count, sizeof(count));
+	append(index.data(), index.size() * entry_size);
+	for (const auto &l : levels)
+		append(l.data(), l.size());
+
+	write_file(path, out);
+}
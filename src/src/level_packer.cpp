@@ -0,0 +1,75 @@
+#include "level.h"
+#include "level_pack.h"
+#include "mapped_file.h"
+
+#include <iostream>
+#include <vector>
+
+// builds a .lvlpack from a directory of levels named like get_levels expects, in the order the game would play them
+// usage: level_packer <level directory> <output.lvlpack>
+
+int main(int argc, char **argv)
+{
+	if (argc != 3)
+	{
+		std::cerr << "usage: " << argv[0] << " <level directory> <output.lvlpack>\n";
+		return 1;
+	}
+
+	std::filesystem::path directory = argv[1];
+	std::filesystem::path output = argv[2];
+
+	if (!std::filesystem::is_directory(directory))
+	{
+		std::cerr << directory.string() << " isn't a directory\n";
+		return 1;
+	}
+
+	// copied out of each mapping so only one file is mapped at a time, a big level set can't run out of mappings
+	std::vector<std::vector<unsigned char>> contents;
+
+	// same rules as get_levels, the first readable level of each number is used
+	bool any = false;
+	unsigned int last_index = 0;
+	std::vector<std::string> errors;
+	auto paths = level_files(directory, &errors);
+	for (const auto &e : errors)
+		std::cerr << "skipping " << e << '\n';
+
+	for (const auto &[index, path] : paths)
+	{
+		if (any && index == last_index)
+			continue;
+
+		try
+		{
+			mapped_file file(path);
+			level l;
+			l.read_level({file.data(), file.size()});
+			contents.emplace_back(file.data(), file.data() + file.size());
+		}
+		catch (const std::exception &e)
+		{
+			std::cerr << "skipping " << path.filename().string() << ": " << e.what() << '\n';
+			continue;
+		}
+
+		any = true;
+		last_index = index;
+	}
+
+	std::vector<std::span<const unsigned char>> levels(contents.begin(), contents.end());
+
+	try
+	{
+		level_pack::write(output, levels);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << output.string() << ": " << e.what() << '\n';
+		return 1;
+	}
+
+	std::cout << "packed " << levels.size() << " levels\n";
+	return 0;
+}
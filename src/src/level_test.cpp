@@ -0,0 +1,258 @@
+#include "level.h"
+#include "level_grid.h"
+#include "edit_history.h"
+#include "game.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// checks of level reading and the block index that don't need a window, run by ctest
+
+static int failures = 0;
+
+static void check(bool ok, const char *what)
+{
+	if (!ok)
+	{
+		std::cerr << "failed: " << what << '\n';
+		++failures;
+	}
+}
+
+// blocks far apart used to make the index allocate every cell between them
+static void far_apart_blocks(int distance)
+{
+	level l;
+	l.start = {1, 1};
+	l.end = {2, 1};
+	l.blue_starts = true;
+	l.blocks.emplace_back(glm::ivec2{0, 0}, block::type::normal, color::neutral, direction::up);
+	l.blocks.emplace_back(glm::ivec2{distance, distance}, block::type::spike, color::red, direction::left);
+
+	auto data = l.encode();
+	check(data.size() < 256, "far apart blocks aren't saved with a mask covering the space between them");
+
+	level read;
+	read.read_level(data);
+
+	check(read.blocks.size() == 2, "far apart blocks are read");
+	check(read.index.cell_count() == 2, "the index only stores the occupied cells");
+
+	std::vector<std::uint32_t> found;
+	read.index.query({0, 0}, {10, 10}, found);
+	check(found.size() == 1 && found[0] == 0, "the block at the origin is found");
+
+	found.clear();
+	glm::vec2 far = glm::vec2(distance) * static_cast<float>(game::block_size) + 30.f;
+	read.index.query(far - 5.f, far + 5.f, found);
+	check(found.size() == 1 && found[0] == 1, "the far block is found");
+
+	// a box over everything is answered from the occupied cells
+	found.clear();
+	read.index.query({-100, -100}, far + 100.f, found);
+	check(found == std::vector<std::uint32_t>{0, 1}, "a box over both blocks finds both in level order");
+
+	found.clear();
+	read.index.query({1000, 1000}, {1100, 1100}, found);
+	check(found.empty(), "nothing is found between the blocks");
+}
+
+// v1 records with a type, color or direction out of range are rejected instead of reaching the renderer
+// bytes of 0x80 and up are included, they'd be negative as the char based enums
+static void invalid_v1_records()
+{
+	for (std::size_t field = 0; field < 3; ++field)
+	for (unsigned char value : {0x07, 0x80, 0xff})
+	{
+		level l;
+		l.construct_default();
+		// a mask larger than the v1 records keeps encode from choosing v2
+		l.blocks.emplace_back(glm::ivec2{60000, 0}, block::type::normal, color::neutral, direction::up);
+		auto data = l.encode();
+
+		// the first record follows the tag and header, type, color then direction
+		std::size_t record = 16 + 4 + 2 * 8 + 1;
+		data[record + field] = value;
+
+		level read;
+		bool threw = false;
+		try
+		{
+			read.read_level(data);
+		}
+		catch (const std::runtime_error &)
+		{
+			threw = true;
+		}
+		check(threw, "a v1 record out of range is rejected");
+	}
+}
+
+// v2 stores blocks by cell, the order they had in the level has to come back
+static void block_order_kept()
+{
+	level l;
+	l.start = {0, 0};
+	l.end = {9, 0};
+	l.blue_starts = false;
+	for (int i = 8; i > 0; --i)
+		l.blocks.emplace_back(glm::ivec2{i, 1}, block::type::normal, color::red, direction::up);
+	// two blocks in one cell, the later one first in the level
+	l.blocks.emplace_back(glm::ivec2{3, 2}, block::type::spike, color::blue, direction::left);
+	l.blocks.emplace_back(glm::ivec2{3, 2}, block::type::normal, color::neutral, direction::down);
+
+	auto data = l.encode();
+	level read;
+	read.read_level(data);
+
+	bool same = read.blocks.size() == l.blocks.size();
+	for (std::size_t i = 0; same && i < l.blocks.size(); ++i)
+		same = read.blocks[i].poly.offset == l.blocks[i].poly.offset && read.blocks[i].block_type == l.blocks[i].block_type
+			&& read.blocks[i].block_color == l.blocks[i].block_color && read.blocks[i].dir() == l.blocks[i].dir();
+	check(same, "blocks out of cell order are read back in level order");
+
+	// a level already in cell order doesn't need the order table
+	level sorted = l;
+	std::reverse(sorted.blocks.begin(), sorted.blocks.begin() + 8);
+	check(sorted.encode().size() + l.blocks.size() * 2 == data.size(), "only a level out of cell order stores its order");
+
+}
+
+static bool same_blocks(const std::vector<block> &a, const std::vector<block> &b)
+{
+	if (a.size() != b.size())
+		return false;
+	for (std::size_t i = 0; i < a.size(); ++i)
+		if (a[i].poly.offset != b[i].poly.offset || a[i].block_type != b[i].block_type || a[i].block_color != b[i].block_color || a[i].dir() != b[i].dir())
+			return false;
+	return true;
+}
+
+// the editor's grid keeps the level's order, collisions resolve in it
+static void grid_keeps_order()
+{
+	level l;
+	l.start = {0, 0};
+	l.end = {15, 0};
+	l.blocks.emplace_back(glm::ivec2{5, 3}, block::type::normal, color::red, direction::up);
+	l.blocks.emplace_back(glm::ivec2{1, 1}, block::type::spike, color::blue, direction::left);
+	l.blocks.emplace_back(glm::ivec2{1, 1}, block::type::spike, color::neutral, direction::up);
+	// shares a slot with the first block, hidden in the editor but still saved
+	l.blocks.emplace_back(glm::ivec2{5, 3}, block::type::jump, color::blue, direction::right);
+	l.blocks.emplace_back(glm::ivec2{20, 2}, block::type::normal, color::neutral, direction::up);
+	l.blocks.emplace_back(glm::ivec2{0, 8}, block::type::normal, color::neutral, direction::up);
+
+	level saved = l;
+	level_grid grid(l);
+	grid.write(saved);
+	check(same_blocks(saved.blocks, l.blocks), "an unchanged level is saved unchanged");
+
+	// a replaced block keeps its place, a new one goes last
+	grid.place(block({1, 1}, block::type::spike, color::red, direction::left));
+	grid.place(block({7, 7}, block::type::jump, color::red, direction::up));
+	grid.write(saved);
+	std::vector<block> expected = l.blocks;
+	expected[1] = block({1, 1}, block::type::spike, color::red, direction::left);
+	expected.emplace_back(glm::ivec2{7, 7}, block::type::jump, color::red, direction::up);
+	check(same_blocks(saved.blocks, expected), "placed blocks keep the order");
+
+	// editing the cell of a hidden block drops it
+	grid.remove(glm::vec2(5.5f, 3.5f) * static_cast<float>(game::block_size));
+	grid.write(saved);
+	expected.erase(expected.begin() + 3);
+	expected.erase(expected.begin());
+	check(same_blocks(saved.blocks, expected), "a hidden block goes with the edit of its cell");
+}
+
+// undo and redo restore the cells and the anchors a step changed
+static void history_round_trip()
+{
+	level_grid grid;
+	edit_history history;
+	edit_history::anchors anchors{{3, 3}, {8, 3}, true, true};
+	auto state_at = [&](glm::ivec2 c) { return grid.state(c); };
+
+	history.touch(grid, {1, 1});
+	grid.place(block({1, 1}, block::type::jump, color::red, direction::up));
+	history.commit(grid, anchors);
+	auto placed = state_at({1, 1});
+
+	// painting over the spawn anchor removes it in the same step
+	history.touch_anchors(anchors);
+	anchors.has_spawn = false;
+	history.touch(grid, {3, 3});
+	grid.place(block({3, 3}, block::type::normal, color::blue, direction::left));
+	history.commit(grid, anchors);
+	auto painted = state_at({3, 3});
+
+	check(history.undo(grid, anchors), "the anchor step is undone");
+	check(anchors.has_spawn && anchors.start == glm::ivec2(3, 3) && state_at({3, 3}) == 0, "undo puts the anchor back and clears its cell");
+	check(history.undo(grid, anchors), "the first step is undone");
+	check(state_at({1, 1}) == 0 && anchors.has_spawn, "undo of a step without anchors leaves them");
+	check(!history.undo(grid, anchors), "nothing is left to undo");
+
+	check(history.redo(grid, anchors) && history.redo(grid, anchors), "both steps are redone");
+	check(state_at({1, 1}) == placed && state_at({3, 3}) == painted && !anchors.has_spawn, "redo paints over the anchor again");
+	check(!history.redo(grid, anchors), "nothing is left to redo");
+
+	// a new step after an undo drops what could have been redone, its anchors included
+	history.undo(grid, anchors);
+	history.touch(grid, {5, 5});
+	grid.place(block({5, 5}, block::type::spike, color::neutral, direction::down));
+	history.commit(grid, anchors);
+	check(!history.can_redo(), "a new step discards the undone one");
+	history.undo(grid, anchors);
+	check(anchors.has_spawn && state_at({5, 5}) == 0 && state_at({1, 1}) == placed, "the discarded anchor step isn't replayed");
+
+	// a step that changed nothing isn't kept
+	history.touch(grid, {6, 6});
+	history.commit(grid, anchors);
+	history.touch_anchors(anchors);
+	history.commit(grid, anchors);
+	check(history.can_redo() && history.undo(grid, anchors) && !history.can_undo(), "steps without changes aren't kept and keep redo");
+}
+
+// a cell state puts back the same blocks, and the shape tools cover the right cells
+static void grid_cells()
+{
+	level_grid grid;
+	grid.place(block({2, 2}, block::type::normal, color::red, direction::right));
+	grid.place(block({2, 2}, block::type::spike, color::blue, direction::up));
+	grid.place(block({2, 2}, block::type::spike, color::red, direction::down));
+	auto s = grid.state({2, 2});
+	check(s != 0, "a cell with blocks has a state");
+
+	level_grid other;
+	other.set_state({2, 2}, s);
+	check(other.state({2, 2}) == s, "set_state round trips");
+
+	grid.clear({2, 2});
+	check(grid.state({2, 2}) == 0, "a cleared cell is empty");
+
+	check(level_grid::rect_cells({1, 1}, {3, 2}).size() == 6, "a rectangle covers every cell");
+	check(level_grid::rect_cells({-5, -5}, {0, 0}).size() == 1, "a rectangle is clipped to the map");
+	check(level_grid::line_cells({0, 0}, {7, 3}).size() == 8, "a line has a cell per step of its longer axis");
+
+	level_grid filled;
+	for (int x = 0; x < level_grid::width; ++x)
+		filled.place(block({x, 4}, block::type::normal, color::neutral, direction::up));
+	check(filled.flood_cells({0, 0}).size() == static_cast<std::size_t>(4 * level_grid::width), "a fill stops at a wall of blocks");
+	check(filled.flood_cells({0, 4}).size() == static_cast<std::size_t>(level_grid::width), "a fill covers connected blocks of the same kind");
+}
+
+int main()
+{
+	invalid_v1_records();
+	block_order_kept();
+	grid_keeps_order();
+	history_round_trip();
+	grid_cells();
+	far_apart_blocks(10000);
+	far_apart_blocks(40000);
+
+	if (failures)
+		return 1;
+	std::cout << "all passed\n";
+	return 0;
+}
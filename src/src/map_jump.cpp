@@ -2,11 +2,27 @@
 #include "run_game.h"
 #include "menu.h"
 
-// returns buttons.size() if no selection
-std::size_t select_level_menu(gl_instance &gl, const std::vector<button> &buttons);
+#ifdef MAPJUMP_DEBUG
+#include <chrono>
+#include <iostream>
+#endif
+
+// shows a page of levels at a time starting on the page of current, so only one page of buttons exists however many levels there are
+// returns level_count if no selection
+std::size_t select_level_menu(gl_instance &gl, std::size_t level_count, std::size_t current);
+
+static std::basic_string<std::uint32_t> level_name(std::size_t level)
+{
+	std::string name = "Level " + std::to_string(level + 1);
+	return {name.begin(), name.end()};
+}
 
 int main()
 {
+#ifdef MAPJUMP_DEBUG
+	auto startup_begin = std::chrono::steady_clock::now();
+#endif
+
 	gl_instance gl(target_width, target_height, "Map Jumper");
 	const auto &win = gl.get_window();
 
@@ -20,29 +36,10 @@ int main()
 		quit,
 	};
 
-	auto levels = get_levels("levels");
+	// a pack built by level_packer loads faster than the directory it was built from
+	auto levels = get_levels(std::filesystem::exists("levels.lvlpack") ? "levels.lvlpack" : "levels");
 	std::size_t cur_level = 0;
 
-	// construct and organize level buttons
-	std::vector<button> level_buttons;
-	{
-		glm::vec2 level_button_size{target_width * .1f, target_height * .1f};
-		float level_gap = 20;
-		float init_y = target_height - level_gap - level_button_size.x / 2;
-		glm::vec2 cur_loc{level_gap + level_button_size.x / 2, init_y};
-		level_buttons.reserve(levels.size());
-		for (std::size_t i = 0; i < levels.size(); ++i)
-		{
-			level_buttons.emplace_back(gl.get_font(), cur_loc, level_button_size, "Level " + std::to_string(i + 1));
-			cur_loc.y -= level_button_size.y + level_gap;
-			if (cur_loc.y - level_button_size.y / 2 < level_gap)
-			{
-				cur_loc.y = init_y;
-				cur_loc.x += level_button_size.x + level_gap;
-			}
-		}
-	}
-
 	text level_text(gl.get_font());
 
 	auto set_text = [&](const std::basic_string<std::uint32_t> &str)
@@ -59,10 +56,24 @@ int main()
 		glm::vec2 desired_text_min{glm::vec2{target_width / 2.f, height / 2.f + 20} - level_text_bound.dims * scale_diff / 2.f};
 		level_text.set_text_origin(desired_text_min - level_text_bound.min * scale_diff);
 	};
-	set_text(level_buttons[cur_level].get_text().get_string());
+	set_text(level_name(cur_level));
 	
 	auto draw_text = [&]() { level_text.draw(gl); };
 
+#ifdef MAPJUMP_DEBUG
+	// the first frame is shown here, once, before the menu draws its buttons over it
+	// glFinish waits for the gpu to be done with it, texture uploads still in flight included
+	glClearColor(1, 1, 1, 1);
+	glClear(GL_COLOR_BUFFER_BIT);
+	draw_text();
+	glfwSwapBuffers(win.handle);
+	glFinish();
+	std::cout << "time to first frame " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startup_begin).count() << " ms\n";
+#endif
+
+	// switched with V while playing, kept between runs
+	frame_pacer::mode pacing = frame_pacer::mode::sleep;
+
 	while (!glfwWindowShouldClose(win.handle))
 	{
 		std::size_t option = main_menu.run(gl, draw_text);
@@ -70,17 +81,17 @@ int main()
 		switch ((options)option)
 		{
 		case play_game:
-			if (std::size_t level_change = run_game(gl, std::ranges::subrange(levels.begin() + cur_level, levels.end())))
+			if (std::size_t level_change = run_game(gl, std::ranges::subrange(levels.begin() + cur_level, levels.end()), pacing))
 			{
 				cur_level += level_change;
-				set_text(level_buttons[cur_level].get_text().get_string());
+				set_text(level_name(cur_level));
 			}
 			break;
 		case select_level:
-			if (std::size_t select = select_level_menu(gl, level_buttons); select < level_buttons.size())
+			if (std::size_t select = select_level_menu(gl, levels.size(), cur_level); select < levels.size())
 			{
 				cur_level = select;
-				set_text(level_buttons[cur_level].get_text().get_string());
+				set_text(level_name(cur_level));
 			}
 			break;
 		case instructions:
@@ -96,7 +107,9 @@ int main()
 						"--------------------------------------\n"
 						"Left Click: Switch Active Block Color\n"
 						"Space: Jump\n"
-						"A/D: Move Left/Right\n");
+						"A/D: Move Left/Right\n"
+						"V: Switch Between VSync and Frame Limiting\n"
+						"F3: Show Frame Time\n");
 			break;
 		case quit:
 			return 0;
@@ -111,38 +124,68 @@ int WinMain()
 }
 #endif
 
-std::size_t select_level_menu(gl_instance &gl, const std::vector<button> &buttons)
+// buttons of a page are in columns top to bottom, as many as fit above the page buttons
+static constexpr glm::vec2 level_button_size{target_width * .1f, target_height * .1f};
+static constexpr float level_gap = 20;
+static constexpr int level_rows = 6;
+static constexpr int level_columns = 8;
+static constexpr std::size_t levels_per_page = level_rows * level_columns;
+
+static std::vector<button> level_page(gl_instance &gl, std::size_t page, std::size_t level_count)
+{
+	std::size_t first = page * levels_per_page;
+	std::size_t last = std::min(first + levels_per_page, level_count);
+
+	std::vector<button> buttons;
+	buttons.reserve(last - first);
+	for (std::size_t i = first; i < last; ++i)
+	{
+		int column = static_cast<int>((i - first) / level_rows);
+		int row = static_cast<int>((i - first) % level_rows);
+		glm::vec2 center{level_gap + level_button_size.x / 2 + column * (level_button_size.x + level_gap),
+			target_height - level_gap - level_button_size.y / 2 - row * (level_button_size.y + level_gap)};
+		buttons.emplace_back(gl.get_font(), center, level_button_size, "Level " + std::to_string(i + 1));
+	}
+	return buttons;
+}
+
+std::size_t select_level_menu(gl_instance &gl, std::size_t level_count, std::size_t current)
 {
 	const auto &win = gl.get_window();
 
-	std::size_t select = buttons.size();
-	
+	std::size_t page_count = (level_count + levels_per_page - 1) / levels_per_page;
+	std::size_t page = std::min(current, level_count - 1) / levels_per_page;
+	std::vector<button> buttons = level_page(gl, page, level_count);
+
+	// previous and next page, only shown with more than one page
+	std::vector<button> page_buttons;
+	if (page_count > 1)
+	{
+		glm::vec2 size{level_button_size.x, level_button_size.y * .6f};
+		float y = level_gap / 2 + size.y / 2;
+		page_buttons.emplace_back(gl.get_font(), glm::vec2{level_gap + size.x / 2, y}, size, "<");
+		page_buttons.emplace_back(gl.get_font(), glm::vec2{target_width - level_gap - size.x / 2, y}, size, ">");
+	}
+
+	std::size_t select = level_count;
+	std::size_t hovered = button_under(buttons, get_mouse_pos(gl));
+	std::size_t hovered_page = button_under(page_buttons, get_mouse_pos(gl));
+
 	auto draw = [&]()
 	{
-		glm::dvec2 mouse_pos = get_mouse_pos(gl);
-		
 		glClearColor(1, 1, 1, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
 		for (std::size_t i = 0; i < buttons.size(); ++i)
-		{
-			glm::vec4 color;
-			if (buttons[i].in_button(mouse_pos))
-			{
-				if (gl.get_left_click().is_initial_press())
-					select = i;
-				color = {.2, .2, .2, .2};
-			}
-			else
-				color = {.1, .1, .1, .1};
-			
-			buttons[i].draw(gl, color);
-		}
+			buttons[i].draw(gl, i == hovered ? glm::vec4{.2, .2, .2, .2} : glm::vec4{.1, .1, .1, .1});
+		for (std::size_t i = 0; i < page_buttons.size(); ++i)
+			page_buttons[i].draw(gl, i == hovered_page ? glm::vec4{.2, .2, .2, .2} : glm::vec4{.1, .1, .1, .1});
 
 		glfwSwapBuffers(win.handle);
 	};
 
-	gl.register_draw_function(draw);
+	scoped_draw_function registration(gl, draw);
+	draw();
 
 	while (!glfwWindowShouldClose(win.handle))
 	{
@@ -154,11 +197,31 @@ std::size_t select_level_menu(gl_instance &gl, const std::vector<button> &button
 
 		gl.get_left_click().update(glfwGetMouseButton(win.handle, GLFW_MOUSE_BUTTON_LEFT));
 
-		draw();
+		// the old page's buttons are freed when it's replaced
+		if (gl.get_left_click().is_initial_press() && hovered_page < page_buttons.size())
+		{
+			page = hovered_page == 0 ? (page + page_count - 1) % page_count : (page + 1) % page_count;
+			buttons = level_page(gl, page, level_count);
+			hovered = buttons.size();
+			draw();
+		}
+
+		// nothing changes on screen unless the highlighted button does
+		std::size_t under = button_under(buttons, get_mouse_pos(gl));
+		std::size_t under_page = button_under(page_buttons, get_mouse_pos(gl));
+		if (under != hovered || under_page != hovered_page)
+		{
+			hovered = under;
+			hovered_page = under_page;
+			draw();
+		}
 
-		if (select < buttons.size())
+		if (gl.get_left_click().is_initial_press() && hovered < buttons.size())
+		{
+			select = page * levels_per_page + hovered;
 			break;
+		}
 	}
 
 	return select;
-}
\ No newline at end of file
+}
@@ -0,0 +1,191 @@
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+mapped_file::mapped_file(const std::filesystem::path &filename) : mapped_file()
+{
+	HANDLE file = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Couldn't open file for reading");
+	m_handle = file;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size))
+	{
+		close();
+		throw std::runtime_error("Couldn't open file for reading");
+	}
+
+	// windows can't map an empty file
+	m_size = static_cast<std::size_t>(size.QuadPart);
+	if (m_size == 0)
+		return;
+
+	m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_mapping)
+		m_data = static_cast<const unsigned char *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!m_data)
+	{
+		close();
+		throw std::runtime_error("Couldn't map file");
+	}
+}
+
+void mapped_file::close()
+{
+	if (m_data)
+		UnmapViewOfFile(m_data);
+	if (m_mapping)
+		CloseHandle(m_mapping);
+	if (m_handle)
+		CloseHandle(m_handle);
+
+	m_data = nullptr;
+	m_size = 0;
+	m_handle = nullptr;
+	m_mapping = nullptr;
+}
+
+void write_file(const std::filesystem::path &filename, std::span<const unsigned char> data)
+{
+	auto tmp = filename;
+	tmp += ".tmp";
+
+	HANDLE file = CreateFileW(tmp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Couldn't open file for writing");
+
+	bool written = true;
+	for (std::size_t done = 0; written && done < data.size();)
+	{
+		DWORD part = static_cast<DWORD>(std::min<std::size_t>(data.size() - done, 1 << 30));
+		DWORD wrote = 0;
+		written = WriteFile(file, data.data() + done, part, &wrote, nullptr) && wrote != 0;
+		done += wrote;
+	}
+	written = written && FlushFileBuffers(file);
+	CloseHandle(file);
+
+	if (!written || !MoveFileExW(tmp.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+	{
+		DeleteFileW(tmp.c_str());
+		throw std::runtime_error("Couldn't write file");
+	}
+}
+#else
+mapped_file::mapped_file(const std::filesystem::path &filename) : mapped_file()
+{
+	int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		throw std::runtime_error("Couldn't open file for reading");
+
+	struct stat info;
+	if (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode))
+	{
+		::close(fd);
+		throw std::runtime_error("Couldn't open file for reading");
+	}
+
+	// mmap can't map an empty file
+	m_size = static_cast<std::size_t>(info.st_size);
+	if (m_size != 0)
+	{
+		void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED)
+		{
+			::close(fd);
+			m_size = 0;
+			throw std::runtime_error("Couldn't map file");
+		}
+		m_data = static_cast<const unsigned char *>(data);
+	}
+
+	::close(fd);
+}
+
+void mapped_file::close()
+{
+	if (m_data)
+		munmap(const_cast<unsigned char *>(m_data), m_size);
+
+	m_data = nullptr;
+	m_size = 0;
+}
+
+void write_file(const std::filesystem::path &filename, std::span<const unsigned char> data)
+{
+	auto tmp = filename;
+	tmp += ".tmp";
+
+	int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+	if (fd == -1)
+		throw std::runtime_error("Couldn't open file for writing");
+
+	// the rename replaces the old file, so its permissions are carried over to the new one
+	struct stat info;
+	if (::stat(filename.c_str(), &info) == 0)
+		fchmod(fd, info.st_mode & 07777);
+
+	bool written = true;
+	for (std::size_t done = 0; written && done < data.size();)
+	{
+		ssize_t wrote = ::write(fd, data.data() + done, data.size() - done);
+		if (wrote > 0)
+			done += static_cast<std::size_t>(wrote);
+		else
+			written = wrote == -1 && errno == EINTR;
+	}
+	written = written && fsync(fd) == 0;
+	written = ::close(fd) == 0 && written;
+
+	if (!written || std::rename(tmp.c_str(), filename.c_str()) != 0)
+	{
+		::unlink(tmp.c_str());
+		throw std::runtime_error("Couldn't write file");
+	}
+
+	// the rename itself is only durable once the directory is flushed, the new file is complete either way
+	auto dir = filename.parent_path();
+	int dir_fd = ::open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_CLOEXEC);
+	if (dir_fd != -1)
+	{
+		fsync(dir_fd);
+		::close(dir_fd);
+	}
+}
+#endif
+
+mapped_file::mapped_file(mapped_file &&other) noexcept :
+	m_data{std::exchange(other.m_data, nullptr)}, m_size{std::exchange(other.m_size, 0)},
+	m_handle{std::exchange(other.m_handle, nullptr)}, m_mapping{std::exchange(other.m_mapping, nullptr)}
+{
+}
+
+mapped_file &mapped_file::operator=(mapped_file &&other) noexcept
+{
+	if (this != &other)
+	{
+		close();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0);
+		m_handle = std::exchange(other.m_handle, nullptr);
+		m_mapping = std::exchange(other.m_mapping, nullptr);
+	}
+	return *this;
+}
@@ -2,6 +2,7 @@
 #include "button.h"
 #include "utility.h"
 
+#include <array>
 #include <sstream>
 
 menu::menu(gl_instance &gl, const rect &space, const std::vector<std::string> &options)
@@ -23,16 +24,28 @@ menu::menu(gl_instance &gl, const rect &space, const std::vector<std::string> &o
 	}
 }
 
+std::size_t button_under(std::span<const button> buttons, glm::vec2 mouse_pos)
+{
+	for (std::size_t i = 0; i < buttons.size(); ++i)
+		if (buttons[i].in_button(mouse_pos))
+			return i;
+	return buttons.size();
+}
+
+static glm::vec4 button_color(bool hovered)
+{
+	return hovered ? glm::vec4{.2, .2, .2, .2} : glm::vec4{.1, .1, .1, .1};
+}
+
 std::size_t menu::run(gl_instance &gl, std::function<void()> extra_draw) const
 {
 	const auto &win = gl.get_window();
 
 	std::size_t option = m_options.size();
+	std::size_t hovered = button_under(m_options, get_mouse_pos(gl));
 
 	auto draw = [&]()
 	{
-		glm::dvec2 mouse_pos = get_mouse_pos(gl);
-
 		glClearColor(1, 1, 1, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
@@ -40,25 +53,13 @@ std::size_t menu::run(gl_instance &gl, std::function<void()> extra_draw) const
 			extra_draw();
 
 		for (std::size_t i = 0; i < m_options.size(); ++i)
-		{
-			glm::vec4 color;
-			if (m_options[i].in_button(mouse_pos))
-			{
-				if (gl.get_left_click().is_initial_press())
-					option = i;
-				color = {.2, .2, .2, .2};
-			}
-			else
-				color = {.1, .1, .1, .1};
-			
-			m_options[i].draw(gl, color);
-		}
+			m_options[i].draw(gl, button_color(i == hovered));
 
 		glfwSwapBuffers(win.handle);
 	};
 
-	gl.register_draw_function(draw);
-
+	scoped_draw_function registration(gl, draw);
+	draw();
 
 	while (!glfwWindowShouldClose(win.handle))
 	{
@@ -70,10 +71,19 @@ std::size_t menu::run(gl_instance &gl, std::function<void()> extra_draw) const
 		
 		gl.get_left_click().update(glfwGetMouseButton(win.handle, GLFW_MOUSE_BUTTON_LEFT));
 
-		draw();
+		// only redrawn when the highlighted button changes, resizes and refreshes redraw through the registered function
+		std::size_t under = button_under(m_options, get_mouse_pos(gl));
+		if (under != hovered)
+		{
+			hovered = under;
+			draw();
+		}
 
-		if (option < m_options.size())
+		if (gl.get_left_click().is_initial_press() && hovered < m_options.size())
+		{
+			option = hovered;
 			break;
+		}
 	}
 
 	return option;
@@ -161,56 +171,44 @@ bool yes_no(gl_instance &gl, const std::string &message)
 {
 	const auto &win = gl.get_window();
 
-	button yes(gl.get_font(), {target_width / 2.f - target_width * .1, target_height * .15f}, {target_width * .1f, target_width * .05f}, "Yes");
-	button no(gl.get_font(), {target_width / 2.f + target_width * .1, target_height * .15f}, {target_width * .1f, target_width * .05f}, "No");
+	// indexed by the answer
+	const std::array<button, 2> options{
+		button(gl.get_font(), {target_width / 2.f + target_width * .1, target_height * .15f}, {target_width * .1f, target_width * .05f}, "No"),
+		button(gl.get_font(), {target_width / 2.f - target_width * .1, target_height * .15f}, {target_width * .1f, target_width * .05f}, "Yes"),
+	};
+
+	std::size_t hovered = button_under(options, get_mouse_pos(gl));
 
-	std::size_t option = 2;
 	auto draw = [&]()
 	{
-		glm::dvec2 mouse_pos = get_mouse_pos(gl);
-
 		glClearColor(1, 1, 1, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
 		draw_message(gl, message);
 
-		glm::vec4 color;
-		if (no.in_button(mouse_pos))
-		{
-			if (gl.get_left_click().is_initial_press())
-				option = 0;
-			color = {.2, .2, .2, .2};
-		}
-		else
-			color = {.1, .1, .1, .1};
-		
-		no.draw(gl, color);
-
-		if (yes.in_button(mouse_pos))
-		{
-			if (gl.get_left_click().is_initial_press())
-				option = 1;
-			color = {.2, .2, .2, .2};
-		}
-		else
-			color = {.1, .1, .1, .1};
-		
-		yes.draw(gl, color);
+		for (std::size_t i = 0; i < options.size(); ++i)
+			options[i].draw(gl, button_color(i == hovered));
 
 		glfwSwapBuffers(win.handle);
 	};
 
-	gl.register_draw_function(draw);
+	scoped_draw_function registration(gl, draw);
+	draw();
 
 	while (true)
 	{
 		glfwWaitEvents();
 		gl.get_left_click().update(glfwGetMouseButton(win.handle, GLFW_MOUSE_BUTTON_LEFT));
-	
-		draw();
 
-		if (option < 2)
-			return option;
+		std::size_t under = button_under(options, get_mouse_pos(gl));
+		if (under != hovered)
+		{
+			hovered = under;
+			draw();
+		}
+
+		if (gl.get_left_click().is_initial_press() && hovered < options.size())
+			return hovered == 1;
 	}
 }
 
@@ -220,32 +218,22 @@ void message(gl_instance &gl, const std::string &message)
 
 	button ok(gl.get_font(), {target_width / 2.f, target_height * .15f}, {target_width * .1f, target_width * .05f}, "OK");
 
-	bool pressed = false;
+	bool hovered = ok.in_button(get_mouse_pos(gl));
+
 	auto draw = [&]()
 	{
-		glm::dvec2 mouse_pos = get_mouse_pos(gl);
-
 		glClearColor(1, 1, 1, 1);
 		glClear(GL_COLOR_BUFFER_BIT);
 
 		draw_message(gl, message);
 
-		glm::vec4 color;
-		if (ok.in_button(mouse_pos))
-		{
-			if (gl.get_left_click().is_initial_press())
-				pressed = true;
-			color = {.2, .2, .2, .2};
-		}
-		else
-			color = {.1, .1, .1, .1};
-
-		ok.draw(gl, color);
+		ok.draw(gl, button_color(hovered));
 
 		glfwSwapBuffers(win.handle);
 	};
 
-	gl.register_draw_function(draw);
+	scoped_draw_function registration(gl, draw);
+	draw();
 
 	while (true)
 	{
@@ -254,10 +242,15 @@ void message(gl_instance &gl, const std::string &message)
 		if (gl.get_escape_key().is_initial_press())
 			break;
 		gl.get_left_click().update(glfwGetMouseButton(win.handle, GLFW_MOUSE_BUTTON_LEFT));
-	
-		draw();
 
-		if (pressed)
+		bool under = ok.in_button(get_mouse_pos(gl));
+		if (under != hovered)
+		{
+			hovered = under;
+			draw();
+		}
+
+		if (gl.get_left_click().is_initial_press() && hovered)
 			break;
 	}
-}
\ No newline at end of file
+}
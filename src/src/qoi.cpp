@@ -0,0 +1,113 @@
+#include "qoi.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+static constexpr std::size_t header_size = 14;
+static constexpr std::size_t end_marker_size = 8;
+
+static constexpr unsigned char op_index = 0x00;
+static constexpr unsigned char op_diff = 0x40;
+static constexpr unsigned char op_luma = 0x80;
+static constexpr unsigned char op_run = 0xc0;
+static constexpr unsigned char op_rgb = 0xfe;
+static constexpr unsigned char op_rgba = 0xff;
+static constexpr unsigned char op_mask = 0xc0;
+
+static unsigned read_u32(const unsigned char *in)
+{
+	return static_cast<unsigned>(in[0]) << 24 | static_cast<unsigned>(in[1]) << 16 | static_cast<unsigned>(in[2]) << 8 | in[3];
+}
+
+qoi_image qoi_decode(const void *data, std::size_t size)
+{
+	const unsigned char *in = reinterpret_cast<const unsigned char *>(data);
+	if (size < header_size + end_marker_size || in[0] != 'q' || in[1] != 'o' || in[2] != 'i' || in[3] != 'f')
+		throw std::runtime_error("Invalid image.");
+
+	qoi_image res;
+	res.width = static_cast<int>(read_u32(in + 4));
+	res.height = static_cast<int>(read_u32(in + 8));
+	res.channels = in[12];
+	if (res.width <= 0 || res.height <= 0 || (res.channels != 3 && res.channels != 4))
+		throw std::runtime_error("Invalid image.");
+
+	res.pixels.resize(static_cast<std::size_t>(res.width) * res.height * res.channels);
+
+	struct rgba
+	{
+		unsigned char r, g, b, a;
+	};
+
+	rgba index[64]{};
+	rgba px{0, 0, 0, 255};
+	int run = 0;
+
+	std::size_t pos = header_size;
+	std::size_t chunks_end = size - end_marker_size;
+	unsigned char *out = res.pixels.data();
+	unsigned char *out_end = out + res.pixels.size();
+	bool alpha = res.channels == 4;
+
+	while (out != out_end)
+	{
+		if (pos >= chunks_end)
+			throw std::runtime_error("Truncated image.");
+
+		unsigned char b1 = in[pos++];
+		if (b1 == op_rgb)
+		{
+			if (chunks_end - pos < 3)
+				throw std::runtime_error("Truncated image.");
+			px.r = in[pos++];
+			px.g = in[pos++];
+			px.b = in[pos++];
+		}
+		else if (b1 == op_rgba)
+		{
+			if (chunks_end - pos < 4)
+				throw std::runtime_error("Truncated image.");
+			px.r = in[pos++];
+			px.g = in[pos++];
+			px.b = in[pos++];
+			px.a = in[pos++];
+		}
+		else if ((b1 & op_mask) == op_index)
+			px = index[b1];
+		else if ((b1 & op_mask) == op_diff)
+		{
+			px.r += ((b1 >> 4) & 0x03) - 2;
+			px.g += ((b1 >> 2) & 0x03) - 2;
+			px.b += (b1 & 0x03) - 2;
+		}
+		else if ((b1 & op_mask) == op_luma)
+		{
+			if (pos >= chunks_end)
+				throw std::runtime_error("Truncated image.");
+			unsigned char b2 = in[pos++];
+			int vg = (b1 & 0x3f) - 32;
+			px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+			px.g += vg;
+			px.b += vg - 8 + (b2 & 0x0f);
+		}
+		else
+			run = b1 & 0x3f;
+
+		index[(px.r * 3 + px.g * 5 + px.b * 7 + px.a * 11) % 64] = px;
+
+		// a run repeats the previous pixel run + 1 times
+		std::size_t count = std::min<std::size_t>(run + 1, (out_end - out) / res.channels);
+		run = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			out[0] = px.r;
+			out[1] = px.g;
+			out[2] = px.b;
+			if (alpha)
+				out[3] = px.a;
+			out += res.channels;
+		}
+	}
+
+	return res;
+}
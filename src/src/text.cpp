@@ -65,6 +65,7 @@ void font::face_handle::resize()
 void font::load(const void *data, std::size_t size, unsigned int height)
 {
 	m_chars.clear();
+	m_atlas = glyph_atlas{};
 
 	face.load(get_library(), data, size);
 	
@@ -72,55 +73,76 @@ void font::load(const void *data, std::size_t size, unsigned int height)
 	face.resize();
 }
 
-font::character::character(const font *_font, uint32_t c) : text{}, offset{}, advance{}, height{}
+glm::ivec2 font::glyph_atlas::add(const unsigned char *bitmap, int bitmap_width, int bitmap_height, int pitch)
 {
-	load(_font, c);
-}
+	// start a new row
+	if (cursor.x + bitmap_width + padding > width)
+	{
+		cursor.x = padding;
+		cursor.y += row_height + padding;
+		row_height = 0;
+	}
 
-font::character::character(character &&other) : text{std::move(other.text)}, offset{other.offset}, advance{other.advance}, height{other.height}
-{
-	other.offset = {};
-	other.height = {};
-	other.advance = {};
-}
+	GLsizei height = static_cast<GLsizei>(pixels.size() / width);
+	bool grow = cursor.y + bitmap_height + padding > height;
+	if (grow)
+	{
+		if (!height)
+			height = 256;
+		while (cursor.y + bitmap_height + padding > height)
+			height *= 2;
+		pixels.resize(static_cast<std::size_t>(width) * height);
+	}
 
-font::character &font::character::operator=(font::character &&other)
-{
-	text.~texture();
+	glm::ivec2 pos = cursor;
+	for (int y = 0; y < bitmap_height; ++y)
+	{
+		const unsigned char *in = bitmap + static_cast<std::ptrdiff_t>(bitmap_height - y - 1) * pitch;
+		std::copy(in, in + bitmap_width, pixels.begin() + static_cast<std::size_t>(pos.y + y) * width + pos.x);
+	}
 
-	text = std::move(other.text);
-	offset = other.offset;
-	advance = other.advance;
-	height = other.height;
+	cursor.x += bitmap_width + padding;
+	row_height = std::max(row_height, bitmap_height);
 
-	other.offset = {};
-	other.height = {};
-	other.advance = {};
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glBindTexture(GL_TEXTURE_2D, text.id);
+	if (grow)
+	{
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		text.width = width;
+		text.height = height;
+	}
+	else if (bitmap_width && bitmap_height)
+	{
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, pos.x, pos.y, bitmap_width, bitmap_height, GL_RED, GL_UNSIGNED_BYTE, pixels.data() + static_cast<std::size_t>(pos.y) * width + pos.x);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	}
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-	return *this;
+	return pos;
 }
 
-void font::character::load(const font *_font, uint32_t c)
+font::character font::load_character(uint32_t c) const
 {
-	height = _font->get_character_height();
+	character res{};
+	res.height = get_character_height();
 
-	FT_Face face = _font->face.face;
-	if (FT_Load_Char(face, c, FT_LOAD_RENDER))
+	if (FT_Load_Char(face.face, c, FT_LOAD_RENDER))
 		throw std::runtime_error("Couldn't load character");
-	
-	text = texture(GL_RGBA, face->glyph->bitmap.buffer, face->glyph->bitmap.width, face->glyph->bitmap.rows, 1, true);
-	offset.x = face->glyph->bitmap_left;
-	offset.y = face->glyph->bitmap_top;
-	advance = face->glyph->advance.x;
-}
 
-font::character::character(const font::character &other)
-{
-	throw std::runtime_error("You shouldn't be able to get here... For some reason the copy constructor was called for character");
-}
-font::character &font::character::operator=(const font::character &other)
-{
-	throw std::runtime_error("You shouldn't be able to get here... For some reason the copy assignment was called for character");
+	const auto &glyph = *face.face->glyph;
+	res.size = {glyph.bitmap.width, glyph.bitmap.rows};
+	res.atlas_pos = m_atlas.add(glyph.bitmap.buffer, res.size.x, res.size.y, glyph.bitmap.pitch);
+	res.offset.x = glyph.bitmap_left;
+	res.offset.y = glyph.bitmap_top;
+	res.advance = glyph.advance.x;
+
+	return res;
 }
 
 rect text::get_local_rect() const
@@ -130,8 +152,6 @@ rect text::get_local_rect() const
 	if (m_data.empty())
 		return res;
 
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	
 	glm::vec2 max{-m_font->at(m_data.front())->offset.x, 0};
 
 	auto end = m_data.end() - 1;
@@ -143,16 +163,16 @@ rect text::get_local_rect() const
 		cur = m_font->at(*it);
 		max.x += cur->advance >> 6;
 
-		if (float pot = (float)cur->offset.y - cur->text.height; pot < res.min.y)
+		if (float pot = (float)cur->offset.y - cur->size.y; pot < res.min.y)
 			res.min.y = pot;
 		if (cur->offset.y > max.y)
 			max.y = (float)cur->offset.y;
 	}
 
 	cur = m_font->at(*end);
-	max.x += cur->offset.x + cur->text.width;
+	max.x += cur->offset.x + cur->size.x;
 
-	if (float pot = (float)cur->offset.y - cur->text.height; pot < res.min.y)
+	if (float pot = (float)cur->offset.y - cur->size.y; pot < res.min.y)
 		res.min.y = pot;
 	if (cur->offset.y > max.y)
 		max.y = (float)cur->offset.y;
@@ -162,32 +182,16 @@ rect text::get_local_rect() const
 	res.dims *= m_scale;
 	res.min *= m_scale;
 
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-
 	return res;
 }
 
-void text::draw(gl_instance &gl) const
+void text::rebuild() const
 {
-	if (m_data.empty())
-		return;
-
-	const auto &program = gl.get_text_program();
+	m_dirty = false;
 
-	glBindVertexArray(gl.get_shapes().square_vao().id);
-
-	// set uniforms
-	glUseProgram(program.id);
-	glUniformMatrix4fv(glGetUniformLocation(program.id, "ortho"), 1, GL_FALSE, &gl.get_ortho()[0][0]);
-
-	// glActiveTexture(GL_TEXTURE0);
-	// glUniform1i(glGetUniformLocation(program.id, "text"), 0);
-
-	glUniform4f(glGetUniformLocation(program.id, "color"), 0, 0, 0, 1);
-
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	// position, atlas texel
+	std::vector<glm::vec4> vertices;
+	vertices.reserve(m_data.size() * 6);
 
 	auto cur = m_font->at(m_data.front());
 	glm::vec2 origin{m_origin.x - cur->offset.x * m_scale.x, m_origin.y};
@@ -198,21 +202,60 @@ void text::draw(gl_instance &gl) const
 		
 		if (c != ' ')
 		{
-			glm::vec2 sz{cur->text.width, cur->text.height};
-			glm::vec2 cur_loc = {origin.x + (cur->offset.x * m_scale.x), origin.y + (cur->offset.y - sz.y) * m_scale.y};
-		
-			glm::vec2 scale = m_scale * sz;
+			glm::vec2 sz = cur->size;
+			glm::vec2 min = {origin.x + (cur->offset.x * m_scale.x), origin.y + (cur->offset.y - sz.y) * m_scale.y};
+			glm::vec2 max = min + m_scale * sz;
+
+			glm::vec2 text_min = cur->atlas_pos;
+			glm::vec2 text_max = text_min + sz;
 
-			// cur_loc + scale / 2.f because square vao is centered at origin
-			auto model = glm::scale(glm::translate(glm::mat4(1.f), {cur_loc + scale / 2.f, 0}), {scale, 0});
-			glUniformMatrix4fv(glGetUniformLocation(program.id, "model"), 1, GL_FALSE, &model[0][0]);
+			vertices.push_back({min.x, min.y, text_min.x, text_min.y});
+			vertices.push_back({max.x, min.y, text_max.x, text_min.y});
+			vertices.push_back({max.x, max.y, text_max.x, text_max.y});
 
-			glBindTexture(GL_TEXTURE_2D, cur->text.id);
-			glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+			vertices.push_back({min.x, min.y, text_min.x, text_min.y});
+			vertices.push_back({max.x, max.y, text_max.x, text_max.y});
+			vertices.push_back({min.x, max.y, text_min.x, text_max.y});
 		}
 
 		origin.x += (cur->advance >> 6) * m_scale.x;
 	}
 
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-}
\ No newline at end of file
+	m_vertex_count = static_cast<GLsizei>(vertices.size());
+
+	glBindVertexArray(m_buff.id);
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertices.id);
+	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec4), vertices.data(), GL_STATIC_DRAW);
+
+	glVertexAttribPointer(pos_attribute, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), nullptr);
+	glEnableVertexAttribArray(pos_attribute);
+	glVertexAttribPointer(text_pos_attribute, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), reinterpret_cast<void *>(2 * sizeof(float)));
+	glEnableVertexAttribArray(text_pos_attribute);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+}
+
+void text::draw(gl_instance &gl) const
+{
+	if (m_data.empty())
+		return;
+
+	if (m_dirty)
+		rebuild();
+
+	const auto &program = gl.get_text_program();
+
+	// set uniforms
+	glUseProgram(program.id);
+	program.set(uniform::ortho, gl.get_ortho());
+	program.set(uniform::color, glm::vec4{0, 0, 0, 1});
+
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	glBindTexture(GL_TEXTURE_2D, m_font->m_atlas.text.id);
+
+	glBindVertexArray(m_buff.id);
+	glDrawArrays(GL_TRIANGLES, 0, m_vertex_count);
+}